@@ -1,8 +1,20 @@
 import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.components import climate
+from esphome.const import CONF_ID, CONF_MODE, CONF_FAN_MODE, CONF_TARGET_TEMPERATURE
 
 CODEOWNERS = ["@jtkm6"]
 DEPENDENCIES = ["uart"]
-AUTO_LOAD = ["select", "switch"]
+AUTO_LOAD = ["select", "sensor", "switch"]
+MULTI_CONF = True
+
+CONF_UNITS = "units"
+CONF_TX_BUDGET = "tx_budget"
+CONF_VERTICAL_VANE = "vertical_vane"
+CONF_HORIZONTAL_SWING = "horizontal_swing"
+CONF_DISPLAY = "display"
+CONF_UV_LIGHT = "uv_light"
 
 daewoo_ac_ns = cg.esphome_ns.namespace("daewoo_ac")
 DaewooAC = daewoo_ac_ns.class_("DaewooAC")
@@ -10,3 +22,99 @@ DaewooACVaneSelect = daewoo_ac_ns.class_("DaewooACVaneSelect")
 DaewooACDisplaySwitch = daewoo_ac_ns.class_("DaewooACDisplaySwitch")
 DaewooACUVLightSwitch = daewoo_ac_ns.class_("DaewooACUVLightSwitch")
 DaewooACHorizontalSwingSwitch = daewoo_ac_ns.class_("DaewooACHorizontalSwingSwitch")
+DaewooACBus = daewoo_ac_ns.class_("DaewooACBus", cg.Component)
+GroupControlAction = daewoo_ac_ns.class_("GroupControlAction", automation.Action)
+ApplyStateAction = daewoo_ac_ns.class_("ApplyStateAction", automation.Action)
+
+VerticalVanePosition = daewoo_ac_ns.enum("VerticalVanePosition", is_class=True)
+VERTICAL_VANE_POSITIONS = {
+    "SWING": VerticalVanePosition.SWING,
+    "UP": VerticalVanePosition.UP,
+    "UP_MEDIUM": VerticalVanePosition.UP_MEDIUM,
+    "MEDIUM": VerticalVanePosition.MEDIUM,
+    "MEDIUM_DOWN": VerticalVanePosition.MEDIUM_DOWN,
+    "DOWN": VerticalVanePosition.DOWN,
+    "STATIC": VerticalVanePosition.STATIC,
+}
+validate_vertical_vane = cv.enum(VERTICAL_VANE_POSITIONS, upper=True, space="_")
+
+# Optional hub that coordinates several units on one node:
+#
+# daewoo_ac:
+#   - id: ac_bus
+#     units: [living_room_ac, bedroom_ac]
+#     tx_budget: 10
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(DaewooACBus),
+        cv.Required(CONF_UNITS): cv.All(cv.ensure_list(cv.use_id(DaewooAC)), cv.Length(min=1, max=32)),
+        cv.Optional(CONF_TX_BUDGET, default=10): cv.int_range(min=1, max=1000),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_tx_budget(config[CONF_TX_BUDGET]))
+    for unit_id in config[CONF_UNITS]:
+        unit = await cg.get_variable(unit_id)
+        cg.add(var.add_unit(unit))
+
+
+# Fields accepted by the actions that change several fields at once
+STATE_CHANGE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_MODE): cv.templatable(climate.validate_climate_mode),
+        cv.Optional(CONF_TARGET_TEMPERATURE): cv.templatable(cv.temperature),
+        cv.Optional(CONF_FAN_MODE): cv.templatable(climate.validate_climate_fan_mode),
+        cv.Optional(CONF_VERTICAL_VANE): cv.templatable(validate_vertical_vane),
+        cv.Optional(CONF_HORIZONTAL_SWING): cv.templatable(cv.boolean),
+        cv.Optional(CONF_DISPLAY): cv.templatable(cv.boolean),
+        cv.Optional(CONF_UV_LIGHT): cv.templatable(cv.boolean),
+    }
+)
+
+GROUP_CONTROL_ACTION_SCHEMA = STATE_CHANGE_SCHEMA.extend(
+    {
+        cv.Required(CONF_ID): cv.use_id(DaewooACBus),
+    }
+)
+
+APPLY_STATE_ACTION_SCHEMA = STATE_CHANGE_SCHEMA.extend(
+    {
+        cv.Required(CONF_ID): cv.use_id(DaewooAC),
+    }
+)
+
+
+async def state_change_to_code(config, action_id, template_arg, args):
+    parent = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, parent)
+    if CONF_MODE in config:
+        template_ = await cg.templatable(config[CONF_MODE], args, climate.ClimateMode)
+        cg.add(var.set_mode(template_))
+    if CONF_TARGET_TEMPERATURE in config:
+        template_ = await cg.templatable(config[CONF_TARGET_TEMPERATURE], args, float)
+        cg.add(var.set_target_temperature(template_))
+    if CONF_FAN_MODE in config:
+        template_ = await cg.templatable(config[CONF_FAN_MODE], args, climate.ClimateFanMode)
+        cg.add(var.set_fan_mode(template_))
+    if CONF_VERTICAL_VANE in config:
+        template_ = await cg.templatable(config[CONF_VERTICAL_VANE], args, VerticalVanePosition)
+        cg.add(var.set_vertical_vane(template_))
+    for key in (CONF_HORIZONTAL_SWING, CONF_DISPLAY, CONF_UV_LIGHT):
+        if key in config:
+            template_ = await cg.templatable(config[key], args, bool)
+            cg.add(getattr(var, f"set_{key}")(template_))
+    return var
+
+
+@automation.register_action("daewoo_ac.group_control", GroupControlAction, GROUP_CONTROL_ACTION_SCHEMA)
+async def group_control_to_code(config, action_id, template_arg, args):
+    return await state_change_to_code(config, action_id, template_arg, args)
+
+
+@automation.register_action("daewoo_ac.apply_state", ApplyStateAction, APPLY_STATE_ACTION_SCHEMA)
+async def apply_state_to_code(config, action_id, template_arg, args):
+    return await state_change_to_code(config, action_id, template_arg, args)
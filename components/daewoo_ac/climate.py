@@ -6,15 +6,51 @@ from . import daewoo_ac_ns, DaewooAC
 
 CONF_UPDATE_INTERVAL = "update_interval"
 CONF_UART_ID = "uart_id"
+CONF_COMMAND_DEBOUNCE = "command_debounce"
+CONF_IMMEDIATE_POWER_OFF = "immediate_power_off"
+CONF_TRACE_BUFFER_SIZE = "trace_buffer_size"
+CONF_PROFILE_LOOP = "profile_loop"
+CONF_TX_IDLE_CHARS = "tx_idle_chars"
+CONF_TX_TURNAROUND = "tx_turnaround"
+CONF_POLLING = "polling"
+CONF_MIN_UPDATE_INTERVAL = "min_update_interval"
+CONF_MAX_UPDATE_INTERVAL = "max_update_interval"
 
 DaewooAC = daewoo_ac_ns.class_("DaewooAC", climate.Climate, cg.Component)
 
-CONFIG_SCHEMA = climate.climate_schema(DaewooAC).extend(
-    {
-        cv.Optional(CONF_UPDATE_INTERVAL, default="5s"): cv.positive_time_period_milliseconds,
-        cv.Required(CONF_UART_ID): cv.use_id(uart.UARTComponent),
-    }
-).extend(cv.COMPONENT_SCHEMA)
+# Poll intervals are divided into bus slots and must not let loop() poll on every pass.
+poll_interval = cv.All(
+    cv.positive_time_period_milliseconds,
+    cv.Range(min=cv.TimePeriod(milliseconds=100)),
+)
+
+
+def validate_polling(config):
+    if config[CONF_MIN_UPDATE_INTERVAL] > config[CONF_MAX_UPDATE_INTERVAL]:
+        raise cv.Invalid(f"{CONF_MIN_UPDATE_INTERVAL} must not be longer than {CONF_MAX_UPDATE_INTERVAL}")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    climate.climate_schema(DaewooAC)
+    .extend(
+        {
+            cv.Optional(CONF_UPDATE_INTERVAL, default="5s"): poll_interval,
+            cv.Required(CONF_UART_ID): cv.use_id(uart.UARTComponent),
+            cv.Optional(CONF_COMMAND_DEBOUNCE, default="50ms"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_IMMEDIATE_POWER_OFF, default=True): cv.boolean,
+            cv.Optional(CONF_TRACE_BUFFER_SIZE, default=0): cv.int_range(min=0, max=1024),
+            cv.Optional(CONF_PROFILE_LOOP, default=False): cv.boolean,
+            cv.Optional(CONF_TX_IDLE_CHARS, default=4): cv.int_range(min=1, max=255),
+            cv.Optional(CONF_TX_TURNAROUND, default="10ms"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_POLLING, default="fixed"): cv.one_of("fixed", "adaptive", lower=True),
+            cv.Optional(CONF_MIN_UPDATE_INTERVAL, default="1s"): poll_interval,
+            cv.Optional(CONF_MAX_UPDATE_INTERVAL, default="30s"): poll_interval,
+        }
+    )
+    .extend(cv.COMPONENT_SCHEMA),
+    validate_polling,
+)
 
 
 async def to_code(config):
@@ -23,6 +59,22 @@ async def to_code(config):
     await climate.register_climate(var, config)
     
     cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if config[CONF_POLLING] == "adaptive":
+        cg.add(
+            var.set_adaptive_polling(config[CONF_MIN_UPDATE_INTERVAL], config[CONF_MAX_UPDATE_INTERVAL])
+        )
+    cg.add(var.set_command_debounce(config[CONF_COMMAND_DEBOUNCE]))
+    cg.add(var.set_immediate_power_off(config[CONF_IMMEDIATE_POWER_OFF]))
+    cg.add(var.set_tx_idle_chars(config[CONF_TX_IDLE_CHARS]))
+    cg.add(var.set_tx_turnaround(config[CONF_TX_TURNAROUND]))
+
+    if config[CONF_TRACE_BUFFER_SIZE] > 0:
+        # The define only compiles the trace code in; each unit sizes its own buffer.
+        cg.add_define("USE_DAEWOO_AC_TRACE")
+        cg.add(var.set_trace_buffer_size(config[CONF_TRACE_BUFFER_SIZE]))
+
+    if config[CONF_PROFILE_LOOP]:
+        cg.add_define("USE_DAEWOO_AC_PROFILER")
     
     uart_component = await cg.get_variable(config[CONF_UART_ID])
     cg.add(var.set_uart(uart_component))
@@ -1,4 +1,5 @@
 #include "daewoo_ac.h"
+#include "daewoo_ac_bus.h"
 #include <algorithm>
 #include <cstring>
 #include <cstdlib>
@@ -9,17 +10,35 @@ namespace daewoo_ac {
 
 static const char *const TAG = "daewoo_ac.climate";
 
-void DaewooAC::enqueue_ui_change(const std::string &property, const std::string &value) {
-  this->ui_change_queue_.push_back(UiChangeEntry{property, value});
-  if (this->ui_change_queue_.size() > UI_CHANGE_QUEUE_MAX_SIZE) {
-    this->ui_change_queue_.erase(this->ui_change_queue_.begin());
-  }
-  ESP_LOGD(TAG, "Queued UI change: %s = %s", property.c_str(), value.c_str());
-}
+// Time the rest of the enclosing block as one profiler stage.
+#ifdef USE_DAEWOO_AC_PROFILER
+#define DAEWOO_AC_PROFILE(stage) LoopProfiler::Scope profile_scope(this->profiler_, LoopStage::stage)
+#else
+#define DAEWOO_AC_PROFILE(stage)
+#endif
 
 void DaewooAC::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Daewoo AC...");
-  
+
+  if (this->uart_ != nullptr && this->uart_->get_baud_rate() > 0) {
+    // Start bit, data bits, optional parity bit and stop bits per character.
+    uint32_t bits = 1 + this->uart_->get_data_bits() + this->uart_->get_stop_bits() +
+                    (this->uart_->get_parity() != uart::UART_CONFIG_PARITY_NONE ? 1 : 0);
+    uint32_t idle_us = this->tx_idle_chars_ * bits * 1000000UL / this->uart_->get_baud_rate();
+    this->tx_idle_ms_ = std::max<uint32_t>(1, (idle_us + 999) / 1000);
+  }
+  ESP_LOGCONFIG(TAG, "  TX after %u ms line idle, %u ms turnaround", this->tx_idle_ms_, this->tx_turnaround_ms_);
+#ifdef USE_DAEWOO_AC_TRACE
+  this->trace_.allocate(this->trace_buffer_size_);
+  if (this->trace_buffer_size_ > 0) {
+    ESP_LOGCONFIG(TAG, "  UART trace: %u records", this->trace_buffer_size_);
+  }
+#endif
+
+  // Start from the state the AC last reported before the reboot, if any.
+  this->state_pref_ = global_preferences->make_preference<DaewooState>(this->get_object_id_hash() ^ STATE_PREF_HASH);
+  this->restore_state_();
+
   // Initialize with demo data
   this->current_temperature = this->current_temperature_;
   this->target_temperature = this->target_temperature_;
@@ -29,110 +48,402 @@ void DaewooAC::setup() {
   // Initialize swing mode based on initial vane positions
   this->update_swing_mode();
   
-  if (this->display_switch_ != nullptr) {
-    this->display_switch_->publish_state(this->display_on_);
-  }
-
-  if (this->uv_light_switch_ != nullptr) {
-    this->uv_light_switch_->publish_state(this->uv_light_on_);
-  }
-  
   // Publish initial state
   this->publish_state();
-  ESP_LOGD(TAG, "  Display: %s", LOG_STR_ARG(this->display_on_ ? "ON" : "OFF"));
-  ESP_LOGD(TAG, "  UV Light: %s", LOG_STR_ARG(this->uv_light_on_ ? "ON" : "OFF"));
-  ESP_LOGD(TAG, "  Vertical vane: %s", this->vertical_vane_display_value_.c_str());
-  ESP_LOGD(TAG, "  Horizontal swing: %s", this->horizontal_swing_on_ ? "ON" : "OFF");
+  this->log_auxiliary_state_();
 }
 
 void DaewooAC::loop() {
+  if (this->uart_ == nullptr) {
+    return;
+  }
+  DAEWOO_AC_PROFILE(OTHER);
+
   // Always perform non-blocking UART polling to avoid long blocking operations
-  if (this->uart_ != nullptr) {
-    while (this->uart_->available()) {
-      uint8_t byte;
-      this->uart_->read_byte(&byte);
-      this->uart_rx_buffer_.push_back(byte);
+  bool received = false;
+  {
+    DAEWOO_AC_PROFILE(UART_DRAIN);
+    size_t pending;
+    while ((pending = this->uart_->available()) > 0) {
+      size_t space;
+      uint8_t *dst = this->rx_parser_.write_region(&space);
+      if (space == 0) {
+        // Ring is full: consume complete frames first; what remains is always shorter than one frame.
+        this->process_rx_buffer_();
+        continue;
+      }
+      size_t chunk = std::min(pending, space);
+      if (!this->uart_->read_array(dst, chunk)) {
+        break;
+      }
+      // Trace what arrived before the parser judges it, so captures keep noise and broken frames.
+      this->trace_bytes_(TraceDirection::RX, dst, chunk);
+      this->rx_parser_.commit(chunk, this->now_());
+      received = true;
     }
+  }
 
-    // If we have at least one full frame, parse it and clear the buffer.
-    // This keeps loop() fast and non-blocking.
-    if (this->uart_rx_buffer_.size() >= MESSAGE_LENGTH) {
-      std::vector<uint8_t> response(this->uart_rx_buffer_.begin(),
-                                    this->uart_rx_buffer_.begin() + MESSAGE_LENGTH);
-      this->parse_uart_response_(response);
-      this->uart_rx_buffer_.clear();
-    }
+  if (received) {
+    this->process_rx_buffer_();
+  } else if (size_t dropped = this->rx_parser_.expire(this->now_())) {
+    // The line went quiet in the middle of a frame; the rest is not coming.
+    ESP_LOGW(TAG, "Dropping %u stale bytes of an incomplete UART frame", dropped);
   }
 
-  uint32_t interval = this->update_interval_ms_ > 0 ? this->update_interval_ms_ : UPDATE_INTERVAL_DEFAULT_MILLIS;
-  uint32_t now = millis();
-  if (now - this->last_update_ > interval) {
-    this->last_update_ = now;
+  uint32_t now = this->now_();
+  this->check_command_timeout_(now);
+  this->save_state_if_changed_();
 
-    // Send UART message if UART is configured (non-blocking)
-    if (this->uart_ != nullptr) {
-      std::vector<uint8_t> cmd_vec{0xAA, 0x02, 0x01, 0xAD};
-      if (this->ui_change_queue_.size() > 0) {
-        std::array<uint8_t, MESSAGE_LENGTH> frame = this->build_command_frame_from_state_();
-        cmd_vec.assign(frame.begin(), frame.end());
-      }
+  // On the half-duplex line, never start talking over a response that is still coming in.
+  if (!this->line_idle_(now)) {
+    return;
+  }
 
-      this->uart_->write_array(cmd_vec.data(), cmd_vec.size());
+  // Pending UI changes go out on their own schedule: once the debounce window
+  // opened by the first change has elapsed, or right away for a power-off.
+  if (this->has_command_ready(now)) {
+    if (this->bus_ != nullptr && !this->bus_->acquire_tx(true, now)) {
+      return;
+    }
+    Frame<MESSAGE_LENGTH> frame = this->build_command_frame_from_state_();
+    this->write_frame_(frame.data(), frame.size());
+    return;
+  }
 
-      // Print the command sent in hex
-      std::string hex_string;
-      for (uint8_t byte : cmd_vec) {
-        char hex[4];
-        sprintf(hex, "%02X ", byte);
-        hex_string += hex;
+  // Besides the regular cadence, poll once shortly after each command so its
+  // confirmation does not have to wait for the next interval.
+  uint32_t interval = this->get_poll_interval();
+  // Until the AC has answered once, poll in a fast burst that backs off towards the regular interval.
+  bool booting = !this->has_received_frame_;
+  if (booting) {
+    interval = std::min(interval, this->boot_poll_interval_);
+  }
+  bool confirm_poll_due =
+      this->confirm_poll_pending_ && now - this->command_sent_at_ >= COMMAND_CONFIRM_POLL_DELAY_MILLIS;
+  bool regular_poll_due = now - this->last_update_ > interval;
+  if (regular_poll_due || confirm_poll_due || this->poll_at_boot_) {
+    if (this->bus_ != nullptr && !this->bus_->acquire_tx(false, now)) {
+      return;
+    }
+    if (this->bus_ == nullptr || booting) {
+      this->last_update_ = now;
+    } else if (regular_poll_due) {
+      // Stay on the slot the bus assigned instead of drifting with loop() timing,
+      // unless the budget held this poll back for more than a whole interval.
+      this->last_update_ += interval;
+      if (now - this->last_update_ > interval) {
+        this->last_update_ = now;
       }
-      ESP_LOGI(TAG, "Sent UART frame:\t%s", hex_string.c_str());
     }
+    this->confirm_poll_pending_ = false;
+    if (booting && !this->poll_at_boot_) {
+      this->boot_poll_interval_ = std::min<uint32_t>(this->boot_poll_interval_ * 2, BOOT_POLL_MAX_INTERVAL_MILLIS);
+    }
+    this->poll_at_boot_ = false;
+
+    this->write_frame_(POLL_FRAME.data(), POLL_FRAME.size());
+    this->poll_outstanding_ = true;
+    this->poll_sent_at_ = now;
+  }
+}
+
+bool DaewooAC::line_idle_(uint32_t now) const {
+  // A partial frame keeps the line busy until it completes or expire() drops it.
+  if (this->rx_parser_.pending() > 0) {
+    return false;
+  }
+  if (now - this->rx_parser_.last_byte_at() < this->tx_idle_ms_) {
+    return false;
+  }
+  return !this->has_received_frame_ || now - this->last_frame_at_ >= this->tx_turnaround_ms_;
+}
+
+void DaewooAC::adapt_poll_interval_(bool changed) {
+  if (!this->adaptive_polling_) {
+    return;
+  }
+  uint32_t interval = changed ? this->min_update_interval_ms_
+                              : std::min(this->adaptive_interval_ms_ * 2, this->max_update_interval_ms_);
+  if (interval != this->adaptive_interval_ms_) {
+    ESP_LOGV(TAG, "Poll interval now %u ms", interval);
+    this->adaptive_interval_ms_ = interval;
+  }
+}
+
+void DaewooAC::schedule_next_poll(uint32_t delay_ms) {
+  // The regular poll fires once `now - last_update_` exceeds the interval.
+  this->last_update_ = this->now_() + delay_ms - this->get_poll_interval();
+}
+
+void DaewooAC::restore_state_() {
+  DaewooState stored{};
+  if (!this->state_pref_.load(&stored)) {
+    ESP_LOGCONFIG(TAG, "No saved AC state; starting from defaults");
+    return;
+  }
+  if (!state_checksum_valid(stored)) {
+    ESP_LOGW(TAG, "Ignoring saved AC state with a bad checksum");
+    return;
+  }
+
+  ESP_LOGCONFIG(TAG, "Restoring last known AC state");
+  this->daewoo_state_ = stored;
+  this->saved_state_ = stored;
+  this->has_saved_state_ = true;
+  // Decode it into the entity state, but leave has_synced_state_ unset so the
+  // first live frame is still decoded in full. setup() publishes the result.
+  this->decode_daewoo_state_(FIELDS_ALL);
+}
+
+void DaewooAC::save_state_if_changed_() {
+  if (!this->has_synced_state_) {
+    return;
+  }
+  // Preferences end up in flash. The room temperature drifts all day and is not
+  // restored anyway, so only a change to a setting is worth a write.
+  if (this->has_saved_state_ &&
+      (matching_fields_(this->synced_state_, this->saved_state_) & FIELDS_SETTINGS) == FIELDS_SETTINGS) {
+    return;
+  }
+
+  // After a failed save, wait for the next setting change instead of retrying on every loop().
+  if (this->save_failed_ &&
+      (matching_fields_(this->synced_state_, this->failed_save_state_) & FIELDS_SETTINGS) == FIELDS_SETTINGS) {
+    return;
+  }
+
+  if (this->state_pref_.save(&this->synced_state_)) {
+    this->saved_state_ = this->synced_state_;
+    this->has_saved_state_ = true;
+    this->save_failed_ = false;
+  } else {
+    ESP_LOGW(TAG, "Saving AC state failed; retrying after the next setting change");
+    this->failed_save_state_ = this->synced_state_;
+    this->save_failed_ = true;
+  }
+}
+
+void DaewooAC::write_frame_(const uint8_t *data, size_t len) {
+  DAEWOO_AC_PROFILE(TX_WRITE);
+  this->uart_->write_array(data, len);
+  ++this->frames_sent_;
+
+  this->trace_bytes_(TraceDirection::TX, data, len);
+  this->log_frame_(TraceDirection::TX, data, 0, len);
+}
+
+void DaewooAC::trace_bytes_(TraceDirection direction, const uint8_t *data, size_t len) {
+#ifdef USE_DAEWOO_AC_TRACE
+  this->trace_.record_bytes(this->now_(), direction, data, len);
+#endif
+}
+
+template<typename Bytes>
+void DaewooAC::log_frame_(TraceDirection direction, const Bytes &bytes, size_t offset, size_t len) {
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  char hex[MESSAGE_LENGTH * 3 + 1];
+  format_frame_hex(bytes, offset, len < MESSAGE_LENGTH ? len : MESSAGE_LENGTH, hex);
+  ESP_LOGV(TAG, "%s UART frame:\t%s", direction == TraceDirection::TX ? "Sent" : "Received", hex);
+#else
+  (void) direction;
+  (void) bytes;
+  (void) offset;
+  (void) len;
+#endif
+}
+
+void DaewooAC::log_auxiliary_state_() {
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
+  ESP_LOGD(TAG, "  Display: %s", LOG_STR_ARG(this->display_on_ ? "ON" : "OFF"));
+  ESP_LOGD(TAG, "  UV Light: %s", LOG_STR_ARG(this->uv_light_on_ ? "ON" : "OFF"));
+  ESP_LOGD(TAG, "  Vertical vane: %s", this->get_vertical_vane_label());
+  ESP_LOGD(TAG, "  Horizontal swing: %s", this->horizontal_swing_on_ ? "ON" : "OFF");
+#endif
+}
+
+bool DaewooAC::get_last_frame_age(uint32_t *age_ms) const {
+  if (!this->has_received_frame_) {
+    return false;
   }
+  *age_ms = this->now_() - this->last_frame_at_;
+  return true;
+}
+
+#ifdef USE_DAEWOO_AC_PROFILER
+// The host build has no cycle counter worth trusting, so it falls back to micros().
+uint32_t DaewooAC::profiler_ticks_() {
+#ifdef USE_HOST
+  return micros();
+#else
+  return arch_get_cpu_cycle_count();
+#endif
 }
 
-void DaewooAC::parse_uart_response_(const std::vector<uint8_t> &buffer) {
-  if (buffer.size() != MESSAGE_LENGTH) {
-    ESP_LOGW(TAG, "Invalid UART frame: expected %u bytes, got %u bytes", MESSAGE_LENGTH, buffer.size());
+uint32_t DaewooAC::profiler_ticks_per_us_() {
+#ifdef USE_HOST
+  return 1;
+#else
+  return arch_get_cpu_freq_hz() / 1000000;
+#endif
+}
+
+void DaewooAC::dump_profile(bool reset) {
+  ESP_LOGI(TAG, "loop() profile (us):");
+  ESP_LOGI(TAG, "  %-12s %8s %8s %10s", "Stage", "avg", "max", "samples");
+  for (size_t i = 0; i < LOOP_STAGE_COUNT; ++i) {
+    LoopStage stage = static_cast<LoopStage>(i);
+    const StageStats &stats = this->profiler_.stats(stage);
+    ESP_LOGI(TAG, "  %-12s %8u %8u %10u", loop_stage_name(stage), this->profiler_.to_us(stats.average()),
+             this->profiler_.to_us(stats.max), stats.count);
+  }
+  if (reset) {
+    this->profiler_.reset();
+  }
+}
+#endif
+
+#ifdef USE_DAEWOO_AC_TRACE
+void DaewooAC::dump_trace(bool clear) {
+  if (this->trace_.capacity() == 0) {
+    ESP_LOGI(TAG, "UART trace is disabled for this unit (trace_buffer_size: 0)");
     return;
   }
+  ESP_LOGI(TAG, "UART trace (%u of %u records):", this->trace_.size(), this->trace_.capacity());
+  for (size_t i = 0; i < this->trace_.size(); ++i) {
+    const TraceRecord &entry = this->trace_[i];
+    char hex[MESSAGE_LENGTH * 3 + 1];
+    format_frame_hex(entry.bytes, 0, entry.length, hex);
+    ESP_LOGI(TAG, "  %10u %s %s", entry.timestamp, entry.direction == TraceDirection::TX ? "TX" : "RX", hex);
+  }
+  if (clear) {
+    this->trace_.clear();
+  }
+}
+#endif
 
-  if (buffer[0] != 0xAA) {
-    char hex[4];
-    sprintf(hex, "%02X ", buffer[0]);
-    ESP_LOGW(TAG, "Invalid UART frame: expected 0xAA, got %s", hex);
+void DaewooAC::process_rx_buffer_() {
+  DAEWOO_AC_PROFILE(PARSE);
+  size_t discarded = this->rx_parser_.process([this](const FrameParser::View &frame) {
+    this->parse_uart_response_(frame);
+  });
+
+  if (discarded > 0) {
+    const FrameParserStats &stats = this->rx_parser_.stats();
+    ESP_LOGW(TAG, "Discarded %u bytes while resynchronizing UART stream (%u length, %u checksum errors so far)",
+             discarded, stats.length_errors, stats.checksum_errors);
+  }
+}
+
+void DaewooAC::parse_uart_response_(const FrameParser::View &frame) {
+  if (frame.size() != MESSAGE_LENGTH) {
+    ESP_LOGW(TAG, "Invalid UART frame: expected %u bytes, got %u bytes", MESSAGE_LENGTH, frame.size());
     return;
   }
 
-  if (buffer[1] + 2U != MESSAGE_LENGTH) {
-    ESP_LOGW(TAG, "Invalid UART frame: expected %u bytes, got %u bytes", MESSAGE_LENGTH - 2U, buffer[1]);
+  this->log_frame_(TraceDirection::RX, frame, 0, frame.size());
+
+  uint32_t now = this->now_();
+  this->last_frame_at_ = now;
+  this->has_received_frame_ = true;
+  if (this->poll_outstanding_) {
+    this->poll_outstanding_ = false;
+    this->poll_rtt_.add(now - this->poll_sent_at_);
+  }
+
+  frame.copy_to(reinterpret_cast<uint8_t *>(&this->daewoo_state_), 2U, sizeof(DaewooState));
+
+  this->confirm_command_();
+
+  // Most status frames repeat the previous one; only decode fields whose bytes
+  // changed, plus any the UI touched locally since the last sync.
+  uint8_t fields = this->resync_fields_;
+  if (!this->has_synced_state_) {
+    fields = FIELDS_ALL;
+  } else if (std::memcmp(&this->daewoo_state_, &this->synced_state_, sizeof(DaewooState)) != 0) {
+    fields |= static_cast<uint8_t>(~matching_fields_(this->daewoo_state_, this->synced_state_));
+  }
+
+  // Room temperature drift alone does not count as activity; the unit keeps backing off.
+  this->adapt_poll_interval_((fields & FIELDS_SETTINGS) != 0);
+
+  // A field with a write still pending or unconfirmed keeps its optimistic value:
+  // this frame may predate the write. Decode it once the AC confirms the write or
+  // check_command_timeout_() abandons it.
+  uint8_t held = fields & (this->dirty_fields_ | this->unconfirmed_fields_);
+  fields &= static_cast<uint8_t>(~held);
+
+  this->synced_state_ = this->daewoo_state_;
+  this->has_synced_state_ = true;
+  this->resync_fields_ = held;
+
+  if (fields != 0) {
+    this->sync_daewoo_state(fields);
+  }
+}
+
+uint8_t DaewooAC::matching_fields_(const DaewooState &a, const DaewooState &b) {
+  uint8_t fields = 0;
+  if (a.power_state == b.power_state && (a.power_state == 0x00 || a.mode == b.mode))
+    fields |= FIELD_MODE;
+  if (a.target_temperature == b.target_temperature)
+    fields |= FIELD_TARGET_TEMPERATURE;
+  if (a.fan_mode == b.fan_mode && ((a.flags1 ^ b.flags1) & QUIET_FLAG_MASK) == 0)
+    fields |= FIELD_FAN_MODE;
+  if (a.vertical_vane == b.vertical_vane)
+    fields |= FIELD_VERTICAL_VANE;
+  if (((a.flags0 ^ b.flags0) & HORIZONTAL_SWING_FLAG_MASK) == 0)
+    fields |= FIELD_HORIZONTAL_SWING;
+  if (((a.flags1 ^ b.flags1) & DISPLAY_FLAG_MASK) == 0)
+    fields |= FIELD_DISPLAY;
+  if (((a.flags1 ^ b.flags1) & UV_LIGHT_FLAG_MASK) == 0)
+    fields |= FIELD_UV_LIGHT;
+  if (a.current_temperature == b.current_temperature)
+    fields |= FIELD_CURRENT_TEMPERATURE;
+  return fields;
+}
+
+void DaewooAC::confirm_command_() {
+  if (this->unconfirmed_fields_ == 0) {
     return;
   }
 
-  // Validate checksum: sum of all bytes except the last, modulo 256, must equal the last byte
-  uint8_t calculated_checksum = 0;
-  for (size_t i = 0; i < MESSAGE_LENGTH - 1; ++i) {
-    calculated_checksum = static_cast<uint8_t>(calculated_checksum + buffer[i]);
+  uint8_t confirmed = this->unconfirmed_fields_ & matching_fields_(this->daewoo_state_, this->commanded_state_);
+  if (confirmed == 0) {
+    return;
   }
-  uint8_t received_checksum = buffer[MESSAGE_LENGTH - 1];
 
-  if (calculated_checksum != received_checksum) {
-    ESP_LOGW(TAG, "Invalid UART frame checksum: calculated 0x%02X, received 0x%02X", calculated_checksum,
-             received_checksum);
+  this->unconfirmed_fields_ &= static_cast<uint8_t>(~confirmed);
+  if (this->unconfirmed_fields_ == 0) {
+    this->last_confirm_latency_ms_ = this->now_() - this->command_started_at_;
+    ESP_LOGD(TAG, "Command confirmed by AC after %u ms (%u retries)", this->last_confirm_latency_ms_,
+             this->command_retries_);
+  }
+}
+
+void DaewooAC::check_command_timeout_(uint32_t now) {
+  if (this->unconfirmed_fields_ == 0 || this->has_pending_changes()) {
     return;
   }
 
-  std::string hex_string;
-  for (uint8_t byte : buffer) {
-    char hex[4];
-    sprintf(hex, "%02X ", byte);
-    hex_string += hex;
+  // Each retransmission waits twice as long for its confirmation as the previous one.
+  uint32_t timeout = COMMAND_ACK_TIMEOUT_MILLIS << this->command_retries_;
+  if (now - this->command_sent_at_ < timeout) {
+    return;
   }
-  ESP_LOGI(TAG, "Received UART frame:\t%s", hex_string.c_str());
 
-  std::memcpy(&this->daewoo_state_, buffer.data() + 2U, sizeof(DaewooState));
+  if (this->command_retries_ >= COMMAND_MAX_RETRIES) {
+    ++this->failed_commit_count_;
+    ESP_LOGW(TAG, "AC did not confirm fields 0x%02X after %u retries; giving up (%u failed commits)",
+             this->unconfirmed_fields_, this->command_retries_, this->failed_commit_count_);
+    this->unconfirmed_fields_ = 0;
+    return;
+  }
 
-  this->sync_daewoo_state();
+  ++this->command_retries_;
+  ESP_LOGW(TAG, "AC did not confirm fields 0x%02X; retransmitting (retry %u/%u)", this->unconfirmed_fields_,
+           this->command_retries_, COMMAND_MAX_RETRIES);
+  this->mark_dirty_(this->unconfirmed_fields_);
+  this->send_immediately_ = true;
 }
 
 // Helper functions for parsing numeric values from strings without exceptions.
@@ -157,439 +468,401 @@ float parse_float(const std::string &value, float fallback) {
   }
   return v;
 }
+
+bool parse_bool(const std::string &value) { return value == "true" || value == "1" || value == "on"; }
 }  // namespace
 
-void DaewooAC::sync_daewoo_state() {
-  climate::ClimateMode resolved_mode = this->current_mode_;
-  climate::ClimateFanMode resolved_fan_mode = this->current_fan_mode_;
-  bool mode_valid = false;
-  bool fan_valid = false;
+void DaewooAC::sync_daewoo_state(uint8_t fields) {
+  DAEWOO_AC_PROFILE(SYNC);
+  if (this->decode_daewoo_state_(fields)) {
+    this->publish_state();
+    this->log_auxiliary_state_();
+  }
+}
+
+bool DaewooAC::decode_daewoo_state_(uint8_t fields) {
   bool should_publish = false;
 
-  switch (this->daewoo_state_.power_state) {
-    case 0x00:  // OFF
+  if (fields & FIELD_MODE) {
+    climate::ClimateMode resolved_mode = this->current_mode_;
+    bool mode_valid = false;
+
+    if (this->daewoo_state_.power_state == 0x00) {
       resolved_mode = climate::CLIMATE_MODE_OFF;
       mode_valid = true;
-      break;
-    case 0x01:  // ON
-      switch (this->daewoo_state_.mode) {
-        case 0x00:
-          resolved_mode = climate::CLIMATE_MODE_AUTO;
-          mode_valid = true;
-          break;
-        case 0x01:
-          resolved_mode = climate::CLIMATE_MODE_COOL;
-          mode_valid = true;
-          break;
-        case 0x02:
-          resolved_mode = climate::CLIMATE_MODE_DRY;
-          mode_valid = true;
-          break;
-        case 0x03:
-          resolved_mode = climate::CLIMATE_MODE_HEAT;
-          mode_valid = true;
-          break;
-        case 0x04:
-          resolved_mode = climate::CLIMATE_MODE_FAN_ONLY;
-          mode_valid = true;
-          break;
-        default:
-          ESP_LOGW(TAG, "Unknown Daewoo mode value: 0x%02X", this->daewoo_state_.mode);
-          break;
-      }
-      break;
-    default:
+    } else if (this->daewoo_state_.power_state != 0x01) {
       ESP_LOGW(TAG, "Unknown power state value: 0x%02X", this->daewoo_state_.power_state);
-      break;
-  }
+    } else if (MODE_MAP.decode(this->daewoo_state_.mode, &resolved_mode)) {
+      mode_valid = true;
+    } else {
+      ESP_LOGW(TAG, "Unknown Daewoo mode value: 0x%02X", this->daewoo_state_.mode);
+    }
 
-  if (mode_valid) {
-    bool mode_changed = resolved_mode != this->current_mode_;
-    this->current_mode_ = resolved_mode;
-    this->mode = resolved_mode;
+    if (mode_valid) {
+      bool mode_changed = resolved_mode != this->current_mode_;
+      this->current_mode_ = resolved_mode;
+      this->mode = resolved_mode;
 
-    if (mode_changed) {
-      should_publish = true;
-      ESP_LOGD(TAG, "Climate mode updated to %d (power=0x%02X, mode=0x%02X)", static_cast<int>(resolved_mode),
-      this->daewoo_state_.power_state, this->daewoo_state_.mode);
+      if (mode_changed) {
+        should_publish = true;
+        ESP_LOGD(TAG, "Climate mode updated to %d (power=0x%02X, mode=0x%02X)", static_cast<int>(resolved_mode),
+                 this->daewoo_state_.power_state, this->daewoo_state_.mode);
+      }
     }
   }
 
-  bool quiet_forced = (this->daewoo_state_.flags1 & QUIET_FLAG_MASK) != 0;
-
-  if (quiet_forced) {
-    resolved_fan_mode = climate::CLIMATE_FAN_QUIET;
-    fan_valid = true;
-    ESP_LOGD(TAG, "Quiet flag detected (flags=0x%02X); forcing fan mode to QUIET", this->daewoo_state_.flags1);
-  } else {
-    switch (this->daewoo_state_.fan_mode) {
-      case 0x00:
-        resolved_fan_mode = climate::CLIMATE_FAN_AUTO;
-        fan_valid = true;
-        break;
-      case 0x01:
-        resolved_fan_mode = climate::CLIMATE_FAN_LOW;
-        fan_valid = true;
-        break;
-      case 0x02:
-        resolved_fan_mode = climate::CLIMATE_FAN_MEDIUM;
-        fan_valid = true;
-        break;
-      case 0x03:
-        resolved_fan_mode = climate::CLIMATE_FAN_HIGH;
-        fan_valid = true;
-        break;
-      default:
-        ESP_LOGW(TAG, "Unknown fan mode value: 0x%02X", this->daewoo_state_.fan_mode);
-        break;
+  if (fields & FIELD_FAN_MODE) {
+    climate::ClimateFanMode resolved_fan_mode = this->current_fan_mode_;
+    bool fan_valid = false;
+    bool quiet_forced = (this->daewoo_state_.flags1 & QUIET_FLAG_MASK) != 0;
+
+    if (quiet_forced) {
+      resolved_fan_mode = climate::CLIMATE_FAN_QUIET;
+      fan_valid = true;
+      ESP_LOGD(TAG, "Quiet flag detected (flags=0x%02X); forcing fan mode to QUIET", this->daewoo_state_.flags1);
+    } else if (FAN_MODE_MAP.decode(this->daewoo_state_.fan_mode, &resolved_fan_mode)) {
+      fan_valid = true;
+    } else {
+      ESP_LOGW(TAG, "Unknown fan mode value: 0x%02X", this->daewoo_state_.fan_mode);
     }
-  }
 
-  if (fan_valid) {
-    bool fan_changed = resolved_fan_mode != this->current_fan_mode_;
-    this->current_fan_mode_ = resolved_fan_mode;
-    this->fan_mode = resolved_fan_mode;
+    if (fan_valid) {
+      bool fan_changed = resolved_fan_mode != this->current_fan_mode_;
+      this->current_fan_mode_ = resolved_fan_mode;
+      this->fan_mode = resolved_fan_mode;
 
-    if (fan_changed) {
-      should_publish = true;
-      ESP_LOGD(TAG, "Fan mode updated to %d (fan=0x%02X)", static_cast<int>(resolved_fan_mode), this->daewoo_state_.fan_mode);
+      if (fan_changed) {
+        should_publish = true;
+        ESP_LOGD(TAG, "Fan mode updated to %d (fan=0x%02X)", static_cast<int>(resolved_fan_mode),
+                 this->daewoo_state_.fan_mode);
+      }
     }
   }
 
   // Map Daewoo vertical vane byte to internal vertical vane position and update select
-  VerticalVanePosition resolved_vertical_vane = this->vertical_vane_position_;
-  bool vertical_vane_valid = false;
+  if (fields & FIELD_VERTICAL_VANE) {
+    VerticalVanePosition resolved_vertical_vane = this->vertical_vane_position_;
+    bool vertical_vane_valid = false;
 
-  switch (this->daewoo_state_.vertical_vane) {
-    case 0x00:  // SWING
-      resolved_vertical_vane = VerticalVanePosition::SWING;
-      vertical_vane_valid = true;
-      break;
-    case 0x01:  // DOWN
-      resolved_vertical_vane = VerticalVanePosition::DOWN;
-      vertical_vane_valid = true;
-      break;
-    case 0x02:  // MEDIUM_DOWN
-      resolved_vertical_vane = VerticalVanePosition::MEDIUM_DOWN;
-      vertical_vane_valid = true;
-      break;
-    case 0x03:  // MEDIUM
-      resolved_vertical_vane = VerticalVanePosition::MEDIUM;
+    if (VERTICAL_VANE_MAP.decode(this->daewoo_state_.vertical_vane, &resolved_vertical_vane)) {
       vertical_vane_valid = true;
-      break;
-    case 0x04:  // UP_MEDIUM
-      resolved_vertical_vane = VerticalVanePosition::UP_MEDIUM;
-      vertical_vane_valid = true;
-      break;
-    case 0x05:  // UP
-      resolved_vertical_vane = VerticalVanePosition::UP;
-      vertical_vane_valid = true;
-      break;
-    case 0x06:  // STATIC
-      resolved_vertical_vane = VerticalVanePosition::STATIC;
-      vertical_vane_valid = true;
-      break;
-    default:
+    } else {
       ESP_LOGW(TAG, "Unknown vertical vane value: 0x%02X", this->daewoo_state_.vertical_vane);
-      break;
-  }
+    }
 
-  if (vertical_vane_valid && resolved_vertical_vane != this->vertical_vane_position_) {
-    this->apply_vertical_vane_position(resolved_vertical_vane);
-    should_publish = true;
-    ESP_LOGD(TAG, "Vertical vane updated to %s (vertical_vane=0x%02X)",
-             this->vertical_vane_display_value_.c_str(), this->daewoo_state_.vertical_vane);
+    if (vertical_vane_valid && resolved_vertical_vane != this->vertical_vane_position_) {
+      this->apply_vertical_vane_position(resolved_vertical_vane);
+      should_publish = true;
+      ESP_LOGD(TAG, "Vertical vane updated to %s (vertical_vane=0x%02X)",
+               this->get_vertical_vane_label(), this->daewoo_state_.vertical_vane);
+    }
   }
 
   // Bit 0x02 of flags0 controls horizontal swing (ON when set, OFF when cleared).
-  bool horizontal_swing_enabled = (this->daewoo_state_.flags0 & HORIZONTAL_SWING_FLAG_MASK) != 0;
+  if (fields & FIELD_HORIZONTAL_SWING) {
+    bool horizontal_swing_enabled = (this->daewoo_state_.flags0 & HORIZONTAL_SWING_FLAG_MASK) != 0;
 
-  if (horizontal_swing_enabled != this->horizontal_swing_on_) {
-    this->set_horizontal_swing_on(horizontal_swing_enabled);
-    should_publish = true;
-    ESP_LOGD(TAG, "Horizontal swing flag updated to %s (flags0=0x%02X)",
-             horizontal_swing_enabled ? "ON" : "OFF", this->daewoo_state_.flags0);
+    if (horizontal_swing_enabled != this->horizontal_swing_on_) {
+      this->set_horizontal_swing_on(horizontal_swing_enabled);
+      should_publish = true;
+      ESP_LOGD(TAG, "Horizontal swing flag updated to %s (flags0=0x%02X)",
+               horizontal_swing_enabled ? "ON" : "OFF", this->daewoo_state_.flags0);
+    }
   }
 
+  if (fields & FIELD_DISPLAY) {
+    bool display_enabled = (this->daewoo_state_.flags1 & DISPLAY_FLAG_MASK) != 0;
+
+    if (display_enabled != this->display_on_) {
+      this->set_display_on(display_enabled);
+      should_publish = true;
+      ESP_LOGD(TAG, "Display flag updated to %s (flags=0x%02X)", display_enabled ? "ON" : "OFF",
+               this->daewoo_state_.flags1);
+    }
+  }
 
-  bool display_enabled = (this->daewoo_state_.flags1 & DISPLAY_FLAG_MASK) != 0;
+  if (fields & FIELD_UV_LIGHT) {
+    bool uv_light_enabled = (this->daewoo_state_.flags1 & UV_LIGHT_FLAG_MASK) != 0;
 
-  if (display_enabled != this->display_on_) {
-    this->set_display_on(display_enabled);
-    should_publish = true;
-    ESP_LOGD(TAG, "Display flag updated to %s (flags=0x%02X)", display_enabled ? "ON" : "OFF", this->daewoo_state_.flags1);
+    if (uv_light_enabled != this->uv_light_on_) {
+      this->set_uv_light_on(uv_light_enabled);
+      should_publish = true;
+      ESP_LOGD(TAG, "UV light flag updated to %s (flags=0x%02X)", uv_light_enabled ? "ON" : "OFF",
+               this->daewoo_state_.flags1);
+    }
   }
 
+  if (fields & FIELD_TARGET_TEMPERATURE) {
+    uint8_t raw_target_temperature = this->daewoo_state_.target_temperature;
 
-  bool uv_light_enabled = (this->daewoo_state_.flags1 & UV_LIGHT_FLAG_MASK) != 0;
+    if (raw_target_temperature >= MIN_TARGET_TEMPERATURE && raw_target_temperature <= MAX_TARGET_TEMPERATURE) {
+      float resolved_target_temperature = static_cast<float>(raw_target_temperature);
+      bool target_temperature_changed = resolved_target_temperature != this->target_temperature_;
 
-  if (uv_light_enabled != this->uv_light_on_) {
-    this->set_uv_light_on(uv_light_enabled);
-    should_publish = true;
-    ESP_LOGD(TAG, "UV light flag updated to %s (flags=0x%02X)", uv_light_enabled ? "ON" : "OFF", this->daewoo_state_.flags1);
+      this->target_temperature_ = resolved_target_temperature;
+      this->target_temperature = resolved_target_temperature;
+      if (target_temperature_changed) {
+        should_publish = true;
+        ESP_LOGD(TAG, "Target temperature updated to %.1f (raw=0x%02X)", resolved_target_temperature,
+                 this->daewoo_state_.target_temperature);
+      }
+    } else {
+      ESP_LOGW(TAG, "Invalid target temperature value: %u (expected %u-%u)", raw_target_temperature,
+               MIN_TARGET_TEMPERATURE, MAX_TARGET_TEMPERATURE);
+    }
   }
 
+  if (fields & FIELD_CURRENT_TEMPERATURE) {
+    uint8_t raw_current_temperature = this->daewoo_state_.current_temperature;
 
-  uint8_t raw_target_temperature = this->daewoo_state_.target_temperature;
+    if (raw_current_temperature >= MIN_CURRENT_TEMPERATURE && raw_current_temperature <= MAX_CURRENT_TEMPERATURE) {
+      float resolved_current_temperature = static_cast<float>(raw_current_temperature);
+      bool current_temperature_changed = resolved_current_temperature != this->current_temperature_;
 
-  if (raw_target_temperature >= MIN_TARGET_TEMPERATURE && raw_target_temperature <= MAX_TARGET_TEMPERATURE) {
-    float resolved_target_temperature = static_cast<float>(raw_target_temperature);
-    bool target_temperature_changed = resolved_target_temperature != this->target_temperature_;
+      this->current_temperature_ = resolved_current_temperature;
+      this->current_temperature = resolved_current_temperature;
 
-    this->target_temperature_ = resolved_target_temperature;
-    this->target_temperature = resolved_target_temperature;
-    if (target_temperature_changed) {
-      should_publish = true;
-      ESP_LOGD(TAG, "Target temperature updated to %.1f (raw=0x%02X)", resolved_target_temperature,
-               this->daewoo_state_.target_temperature);
+      if (current_temperature_changed) {
+        should_publish = true;
+        ESP_LOGD(TAG, "Current temperature updated to %.1f (raw=0x%02X)", resolved_current_temperature,
+                 this->daewoo_state_.current_temperature);
+      }
+    } else {
+      ESP_LOGW(TAG, "Invalid current temperature value: %u (expected %u-%u)", raw_current_temperature,
+               MIN_CURRENT_TEMPERATURE, MAX_CURRENT_TEMPERATURE);
     }
-  } else {
-    ESP_LOGW(TAG, "Invalid target temperature value: %u (expected %u-%u)", raw_target_temperature,
-             MIN_TARGET_TEMPERATURE, MAX_TARGET_TEMPERATURE);
   }
 
+  return should_publish;
+}
 
-  uint8_t raw_current_temperature = this->daewoo_state_.current_temperature;
+void DaewooAC::mark_dirty_(uint8_t fields) {
+  if (this->dirty_fields_ == 0) {
+    this->dirty_since_ = this->now_();
+  }
+  this->dirty_fields_ |= fields;
+  // The UI now shows a value the AC has not reported; re-decode it from the next frame.
+  this->resync_fields_ |= fields;
+  ESP_LOGD(TAG, "Queued UI change: fields=0x%02X (pending=0x%02X)", fields, this->dirty_fields_);
+}
 
-  if (raw_current_temperature >= MIN_CURRENT_TEMPERATURE && raw_current_temperature <= MAX_CURRENT_TEMPERATURE) {
-    float resolved_current_temperature = static_cast<float>(raw_current_temperature);
-    bool current_temperature_changed = resolved_current_temperature != this->current_temperature_;
+void DaewooAC::request_mode(climate::ClimateMode mode) {
+  this->desired_state_.mode = mode;
+  this->mark_dirty_(FIELD_MODE);
+  if (mode == climate::CLIMATE_MODE_OFF && this->immediate_power_off_) {
+    this->send_immediately_ = true;
+  }
+}
 
-    this->current_temperature_ = resolved_current_temperature;
-    this->current_temperature = resolved_current_temperature;
+void DaewooAC::request_target_temperature(float temperature) {
+  int temp_int = static_cast<int>(std::round(temperature));
+  if (temp_int < MIN_TARGET_TEMPERATURE)
+    temp_int = MIN_TARGET_TEMPERATURE;
+  if (temp_int > MAX_TARGET_TEMPERATURE)
+    temp_int = MAX_TARGET_TEMPERATURE;
+  this->desired_state_.target_temperature = static_cast<uint8_t>(temp_int);
+  this->mark_dirty_(FIELD_TARGET_TEMPERATURE);
+}
 
-    if (current_temperature_changed) {
-      should_publish = true;
-      ESP_LOGD(TAG, "Current temperature updated to %.1f (raw=0x%02X)", resolved_current_temperature,
-               this->daewoo_state_.current_temperature);
-    }
-  } else {
-    ESP_LOGW(TAG, "Invalid current temperature value: %u (expected %u-%u)", raw_current_temperature,
-             MIN_CURRENT_TEMPERATURE, MAX_CURRENT_TEMPERATURE);
+void DaewooAC::request_fan_mode(climate::ClimateFanMode fan_mode) {
+  this->desired_state_.fan_mode = fan_mode;
+  this->mark_dirty_(FIELD_FAN_MODE);
+}
+
+void DaewooAC::request_vertical_vane(VerticalVanePosition position) {
+  this->desired_state_.vertical_vane = position;
+  this->mark_dirty_(FIELD_VERTICAL_VANE);
+}
+
+void DaewooAC::request_horizontal_swing(bool on) {
+  this->desired_state_.horizontal_swing_on = on;
+  this->mark_dirty_(FIELD_HORIZONTAL_SWING);
+}
+
+void DaewooAC::request_display(bool on) {
+  this->desired_state_.display_on = on;
+  this->mark_dirty_(FIELD_DISPLAY);
+}
+
+void DaewooAC::request_uv_light(bool on) {
+  this->desired_state_.uv_light_on = on;
+  this->mark_dirty_(FIELD_UV_LIGHT);
+}
+
+void DaewooAC::apply_state(const StateChange &change) {
+  // loop() cannot run during this call, so every field queued here goes out in
+  // the same command frame once the debounce window opened by the first elapses.
+  bool changed = false;
+  if (change.mode.has_value()) {
+    this->request_mode(*change.mode);
+    this->mode = *change.mode;
+    this->current_mode_ = *change.mode;
+    changed = true;
+  }
+  if (change.target_temperature.has_value()) {
+    this->request_target_temperature(*change.target_temperature);
+    this->target_temperature = static_cast<float>(this->desired_state_.target_temperature);
+    this->target_temperature_ = this->target_temperature;
+    changed = true;
+  }
+  if (change.fan_mode.has_value()) {
+    this->request_fan_mode(*change.fan_mode);
+    this->fan_mode = *change.fan_mode;
+    this->current_fan_mode_ = *change.fan_mode;
+    changed = true;
+  }
+  if (change.vertical_vane.has_value()) {
+    this->request_vertical_vane(*change.vertical_vane);
+    this->set_vertical_vane_position(*change.vertical_vane);
+    changed = true;
+  }
+  if (change.horizontal_swing.has_value()) {
+    this->request_horizontal_swing(*change.horizontal_swing);
+    this->set_horizontal_swing_on(*change.horizontal_swing);
+    changed = true;
+  }
+  if (change.display.has_value()) {
+    this->request_display(*change.display);
+    this->set_display_on(*change.display);
+    changed = true;
+  }
+  if (change.uv_light.has_value()) {
+    this->request_uv_light(*change.uv_light);
+    this->set_uv_light_on(*change.uv_light);
+    changed = true;
+  }
+  if (!changed) {
+    return;
   }
 
-  if (should_publish) {
-    this->publish_state();
-    ESP_LOGD(TAG, "  Display: %s", LOG_STR_ARG(this->display_on_ ? "ON" : "OFF"));
-    ESP_LOGD(TAG, "  UV Light: %s", LOG_STR_ARG(this->uv_light_on_ ? "ON" : "OFF"));
-    ESP_LOGD(TAG, "  Vertical sweep: %s", this->vertical_vane_display_value_.c_str());
-    ESP_LOGD(TAG, "  Horizontal swing: %s", this->horizontal_swing_on_ ? "ON" : "OFF");
+  this->publish_state();
+  this->log_auxiliary_state_();
+}
+
+void DaewooAC::enqueue_ui_change(const std::string &property, const std::string &value) {
+  if (property == "mode") {
+    this->request_mode(static_cast<climate::ClimateMode>(parse_int(value, static_cast<int>(this->current_mode_))));
+  } else if (property == "target_temperature") {
+    this->request_target_temperature(parse_float(value, this->target_temperature_));
+  } else if (property == "fan_mode") {
+    this->request_fan_mode(
+        static_cast<climate::ClimateFanMode>(parse_int(value, static_cast<int>(this->current_fan_mode_))));
+  } else if (property == "display_on") {
+    this->request_display(parse_bool(value));
+  } else if (property == "uv_light_on") {
+    this->request_uv_light(parse_bool(value));
+  } else if (property == "horizontal_swing_on") {
+    this->request_horizontal_swing(parse_bool(value));
+    this->request_vertical_vane(this->vertical_vane_position_);
+  } else if (property == "swing_mode") {
+    // The swing mode itself is derived from both vane states; resend them as they are now.
+    this->request_horizontal_swing(this->horizontal_swing_on_);
+    this->request_vertical_vane(this->vertical_vane_position_);
+  } else if (property == "vertical_vane") {
+    VerticalVanePosition position;
+    if (this->find_vertical_vane_label_(value.c_str(), &position)) {
+      this->request_vertical_vane(position);
+      return;
+    }
+    ESP_LOGW(TAG, "Unknown vertical vane label '%s'; ignoring UI change", value.c_str());
+  } else {
+    ESP_LOGW(TAG, "Unknown UI change property '%s'; ignoring", property.c_str());
   }
 }
 
-void DaewooAC::apply_ui_change_to_state_(DaewooState &state, const UiChangeEntry &change) const {
-  const std::string &prop = change.property;
+void DaewooAC::apply_desired_state_(DaewooState &state, uint8_t fields) const {
+  const DesiredState &desired = this->desired_state_;
 
   // Mode / power state mapping
-  if (prop == "mode") {
-    int mode_int = parse_int(change.value, static_cast<int>(this->current_mode_));
-    auto requested_mode = static_cast<climate::ClimateMode>(mode_int);
-
-    if (requested_mode == climate::CLIMATE_MODE_OFF) {
+  if (fields & FIELD_MODE) {
+    if (desired.mode == climate::CLIMATE_MODE_OFF) {
       state.power_state = 0x00;
     } else {
       state.power_state = 0x01;
-      switch (requested_mode) {
-        case climate::CLIMATE_MODE_AUTO:
-          state.mode = 0x00;
-          break;
-        case climate::CLIMATE_MODE_COOL:
-          state.mode = 0x01;
-          break;
-        case climate::CLIMATE_MODE_DRY:
-          state.mode = 0x02;
-          break;
-        case climate::CLIMATE_MODE_HEAT:
-          state.mode = 0x03;
-          break;
-        case climate::CLIMATE_MODE_FAN_ONLY:
-          state.mode = 0x04;
-          break;
-        default:
-          // Unsupported/unknown mode; keep previous byte.
-          break;
-      }
+      // Unsupported/unknown modes keep the previous mode byte.
+      MODE_MAP.encode(desired.mode, &state.mode);
     }
-    return;
   }
 
-  // Target temperature mapping
-  if (prop == "target_temperature") {
-    float temp = parse_float(change.value, this->target_temperature_);
-    int temp_int = static_cast<int>(std::round(temp));
-    if (temp_int < MIN_TARGET_TEMPERATURE)
-      temp_int = MIN_TARGET_TEMPERATURE;
-    if (temp_int > MAX_TARGET_TEMPERATURE)
-      temp_int = MAX_TARGET_TEMPERATURE;
-    state.target_temperature = static_cast<uint8_t>(temp_int);
-    return;
+  // Target temperature (already rounded and clamped by request_target_temperature())
+  if (fields & FIELD_TARGET_TEMPERATURE) {
+    state.target_temperature = desired.target_temperature;
   }
 
   // Fan mode mapping (fan_mode byte + quiet flag)
-  if (prop == "fan_mode") {
-    int fan_int = parse_int(change.value, static_cast<int>(this->current_fan_mode_));
-    auto requested_fan = static_cast<climate::ClimateFanMode>(fan_int);
-
-    switch (requested_fan) {
-      case climate::CLIMATE_FAN_AUTO:
-        state.fan_mode = 0x00;
-        state.flags1 &= static_cast<uint8_t>(~QUIET_FLAG_MASK);
-        break;
-      case climate::CLIMATE_FAN_LOW:
-        state.fan_mode = 0x01;
-        state.flags1 &= static_cast<uint8_t>(~QUIET_FLAG_MASK);
-        break;
-      case climate::CLIMATE_FAN_MEDIUM:
-        state.fan_mode = 0x02;
-        state.flags1 &= static_cast<uint8_t>(~QUIET_FLAG_MASK);
-        break;
-      case climate::CLIMATE_FAN_HIGH:
-        state.fan_mode = 0x03;
-        state.flags1 &= static_cast<uint8_t>(~QUIET_FLAG_MASK);
-        break;
-      case climate::CLIMATE_FAN_QUIET:
-        // Reuse underlying fan speed from AUTO but mark quiet flag.
-        state.fan_mode = 0x00;
-        state.flags1 |= QUIET_FLAG_MASK;
-        break;
-      default:
-        // Unknown fan mode; leave as-is.
-        break;
+  if (fields & FIELD_FAN_MODE) {
+    if (desired.fan_mode == climate::CLIMATE_FAN_QUIET) {
+      // Reuse underlying fan speed from AUTO but mark quiet flag.
+      state.fan_mode = 0x00;
+      state.flags1 |= QUIET_FLAG_MASK;
+    } else if (FAN_MODE_MAP.encode(desired.fan_mode, &state.fan_mode)) {
+      state.flags1 &= static_cast<uint8_t>(~QUIET_FLAG_MASK);
     }
-    return;
+    // Unknown fan mode; leave as-is.
   }
 
   // Display flag (flags1 bit 0x10)
-  if (prop == "display_on") {
-
-    bool on = (change.value == "true" || change.value == "1" || change.value == "on");
-    if (on) {
+  if (fields & FIELD_DISPLAY) {
+    if (desired.display_on) {
       state.flags1 |= DISPLAY_FLAG_MASK;
     } else {
       state.flags1 &= static_cast<uint8_t>(~DISPLAY_FLAG_MASK);
     }
-    return;
   }
 
   // UV light flag (flags1 bit 0x02, matching sync_daewoo_state())
-  if (prop == "uv_light_on") {
-    bool on = (change.value == "true" || change.value == "1" || change.value == "on");
-    if (on) {
+  if (fields & FIELD_UV_LIGHT) {
+    if (desired.uv_light_on) {
       state.flags1 |= UV_LIGHT_FLAG_MASK;
     } else {
       state.flags1 &= static_cast<uint8_t>(~UV_LIGHT_FLAG_MASK);
     }
-    return;
   }
 
   // Horizontal swing flag (flags0 bit 0x02)
-  if (prop == "horizontal_swing_on" || prop == "swing_mode") {
-    bool swing_on = this->horizontal_swing_on_;
-    if (prop == "horizontal_swing_on") {
-      swing_on = (change.value == "true" || change.value == "1" || change.value == "on");
-    }
-
-    if (swing_on) {
+  if (fields & FIELD_HORIZONTAL_SWING) {
+    if (desired.horizontal_swing_on) {
       state.flags0 |= HORIZONTAL_SWING_FLAG_MASK;
     } else {
       state.flags0 &= static_cast<uint8_t>(~HORIZONTAL_SWING_FLAG_MASK);
     }
-
-    // For swing-related changes, also update the vertical vane byte from the
-    // current vertical vane position so that the frame matches UI intent.
-    switch (this->vertical_vane_position_) {
-      case VerticalVanePosition::SWING:
-        state.vertical_vane = 0x00;
-        break;
-      case VerticalVanePosition::DOWN:
-        state.vertical_vane = 0x01;
-        break;
-      case VerticalVanePosition::MEDIUM_DOWN:
-        state.vertical_vane = 0x02;
-        break;
-      case VerticalVanePosition::MEDIUM:
-        state.vertical_vane = 0x03;
-        break;
-      case VerticalVanePosition::UP_MEDIUM:
-        state.vertical_vane = 0x04;
-        break;
-      case VerticalVanePosition::UP:
-        state.vertical_vane = 0x05;
-        break;
-      case VerticalVanePosition::STATIC:
-      default:
-        state.vertical_vane = 0x06;
-        break;
-    }
-    return;
   }
 
-  // Vertical vane select change; map from current internal vane position
-  if (prop == "vertical_vane") {
-    switch (this->vertical_vane_position_) {
-      case VerticalVanePosition::SWING:
-        state.vertical_vane = 0x00;
-        break;
-      case VerticalVanePosition::DOWN:
-        state.vertical_vane = 0x01;
-        break;
-      case VerticalVanePosition::MEDIUM_DOWN:
-        state.vertical_vane = 0x02;
-        break;
-      case VerticalVanePosition::MEDIUM:
-        state.vertical_vane = 0x03;
-        break;
-      case VerticalVanePosition::UP_MEDIUM:
-        state.vertical_vane = 0x04;
-        break;
-      case VerticalVanePosition::UP:
-        state.vertical_vane = 0x05;
-        break;
-      case VerticalVanePosition::STATIC:
-      default:
-        state.vertical_vane = 0x06;
-        break;
-    }
-    return;
+  // Vertical vane byte
+  if (fields & FIELD_VERTICAL_VANE) {
+    VERTICAL_VANE_MAP.encode(desired.vertical_vane, &state.vertical_vane);
   }
-
-  // Unknown property: ignore for now.
 }
 
-std::array<uint8_t, MESSAGE_LENGTH> DaewooAC::build_command_frame_from_state_() {
+Frame<MESSAGE_LENGTH> DaewooAC::build_command_frame_from_state_() {
+  DAEWOO_AC_PROFILE(FRAME_BUILD);
   // Start from the last known Daewoo state as received from the AC.
   DaewooState working = this->daewoo_state_;
 
-  // Apply all queued UI changes in order; later entries win.
-  for (const auto &change : this->ui_change_queue_) {
-    this->apply_ui_change_to_state_(working, change);
-  }
+  // Merge every pending UI field on top in one pass. Fields of an earlier
+  // command that the AC has not confirmed yet are re-encoded as well, so a
+  // newer frame never reverts them to the last reported value.
+  uint8_t fields = this->dirty_fields_ | this->unconfirmed_fields_;
+  this->apply_desired_state_(working, fields);
 
   // Build the 22-byte UART frame: 0xAA, 0x14, <20-byte payload>, checksum.
-  std::array<uint8_t, MESSAGE_LENGTH> frame{};
-  frame[0] = 0xAA;
-  frame[1] = static_cast<uint8_t>(MESSAGE_LENGTH - 2);  // payload length (0x14)
-
-  // Clear checksum field before computing it.
-  working.checksum = 0x00;
-  std::memcpy(frame.data() + 2U, &working, sizeof(DaewooState));
-
-  // Write writer mode (command identifier for write operation)
-  frame[2] = 0x02;
-
-  // Compute checksum as the sum of all bytes except the last, modulo 256.
-  uint8_t checksum = 0;
-  for (size_t i = 0; i < MESSAGE_LENGTH - 1; ++i) {
-    checksum = static_cast<uint8_t>(checksum + frame[i]);
+  Frame<MESSAGE_LENGTH> frame = encode_state_frame(working, OPERATION_WRITE);
+
+  // All pending UI changes have now been encoded into this command frame;
+  // they stay unconfirmed until a status frame reports them back.
+  uint32_t now = this->now_();
+  if (this->unconfirmed_fields_ == 0) {
+    this->command_started_at_ = now;
+    this->command_retries_ = 0;
   }
-
-  // Write checksum at the end of the frame and into the DaewooState payload.
-  frame[MESSAGE_LENGTH - 1] = checksum;
-  frame[2U + sizeof(DaewooState) - 1U] = checksum;  // last byte of DaewooState in payload
-  
-  // All pending UI changes have now been encoded into this command frame,
-  // so we can clear the queue.
-  this->ui_change_queue_.clear();
+  this->unconfirmed_fields_ = fields;
+  this->commanded_state_ = working;
+  this->command_sent_at_ = now;
+  this->confirm_poll_pending_ = true;
+  this->dirty_fields_ = 0;
+  // The AC may keep adjusting after a command; watch it closely for a while.
+  this->adapt_poll_interval_(true);
+  this->send_immediately_ = false;
 
   return frame;
 }
@@ -598,27 +871,26 @@ void DaewooAC::control(const climate::ClimateCall &call) {
   if (call.get_mode().has_value()) {
     this->mode = *call.get_mode();
     this->current_mode_ = *call.get_mode();
-    this->enqueue_ui_change("mode", std::to_string(static_cast<int>(*call.get_mode())));
+    this->request_mode(*call.get_mode());
     ESP_LOGD(TAG, "Mode changed to: %d", *call.get_mode());
   }
   
   if (call.get_target_temperature().has_value()) {
     this->target_temperature = *call.get_target_temperature();
     this->target_temperature_ = *call.get_target_temperature();
-     this->enqueue_ui_change("target_temperature", std::to_string(*call.get_target_temperature()));
+    this->request_target_temperature(*call.get_target_temperature());
     ESP_LOGD(TAG, "Target temperature changed to: %.1f", *call.get_target_temperature());
   }
   
   if (call.get_fan_mode().has_value()) {
     this->fan_mode = *call.get_fan_mode();
     this->current_fan_mode_ = *call.get_fan_mode();
-    this->enqueue_ui_change("fan_mode", std::to_string(static_cast<int>(*call.get_fan_mode())));
+    this->request_fan_mode(*call.get_fan_mode());
     ESP_LOGD(TAG, "Fan mode changed to: %d", *call.get_fan_mode());
   }
   
   if (call.get_swing_mode().has_value()) {
     auto requested_swing_mode = *call.get_swing_mode();
-    this->enqueue_ui_change("swing_mode", std::to_string(static_cast<int>(requested_swing_mode)));
     ESP_LOGD(TAG, "Swing mode change request: %d", static_cast<int>(requested_swing_mode));
 
     bool vane_positions_updated = false;
@@ -674,14 +946,15 @@ void DaewooAC::control(const climate::ClimateCall &call) {
     if (!vane_positions_updated) {
       this->update_swing_mode();
     }
+
+    // The swing mode maps onto both vane fields; send them as they are now.
+    this->request_vertical_vane(this->vertical_vane_position_);
+    this->request_horizontal_swing(this->horizontal_swing_on_);
   }
   
   // Publish the updated state
   this->publish_state();
-  ESP_LOGD(TAG, "  Display: %s", LOG_STR_ARG(this->display_on_ ? "ON" : "OFF"));
-  ESP_LOGD(TAG, "  UV Light: %s", LOG_STR_ARG(this->uv_light_on_ ? "ON" : "OFF"));
-  ESP_LOGD(TAG, "  Vertical sweep: %s", this->vertical_vane_display_value_.c_str());
-  ESP_LOGD(TAG, "  Horizontal swing: %s", this->horizontal_swing_on_ ? "ON" : "OFF");
+  this->log_auxiliary_state_();
 }
 
 climate::ClimateTraits DaewooAC::traits() {
@@ -723,13 +996,22 @@ climate::ClimateTraits DaewooAC::traits() {
   return traits;
 }
 
-void DaewooAC::set_vertical_vane_position(const std::string &label) {
+bool DaewooAC::find_vertical_vane_label_(const char *label, VerticalVanePosition *position) const {
   for (size_t i = 0; i < this->vertical_vane_labels_.size(); ++i) {
-    if (this->vertical_vane_labels_[i] == label) {
-      this->apply_vertical_vane_position(static_cast<VerticalVanePosition>(i));
-      return;
+    if (std::strcmp(this->vertical_vane_labels_[i], label) == 0) {
+      *position = static_cast<VerticalVanePosition>(i);
+      return true;
     }
   }
+  return false;
+}
+
+void DaewooAC::set_vertical_vane_position(const std::string &label) {
+  VerticalVanePosition position;
+  if (this->find_vertical_vane_label_(label.c_str(), &position)) {
+    this->apply_vertical_vane_position(position);
+    return;
+  }
   ESP_LOGW(TAG, "Unknown vertical vane label '%s'; keeping current state", label.c_str());
 }
 
@@ -755,23 +1037,20 @@ void DaewooAC::set_vertical_vane_labels(const FixedVector<const char *> &options
     ESP_LOGW(TAG, "Vertical vane select provided %zu options; only the first %zu are used",
              options.size(), this->vertical_vane_labels_.size());
   }
-
-  this->vertical_vane_display_value_ =
-      this->vertical_vane_labels_[static_cast<size_t>(this->vertical_vane_position_)];
 }
 
 void DaewooAC::apply_vertical_vane_position(VerticalVanePosition position) {
-  this->vertical_vane_position_ = position;
-  this->vertical_vane_display_value_ =
-      this->vertical_vane_labels_[static_cast<size_t>(this->vertical_vane_position_)];
+  if (this->vertical_vane_position_ == position) {
+    ESP_LOGD(TAG, "Vertical vane already %s", this->get_vertical_vane_label());
+    return;
+  }
 
-  ESP_LOGD(TAG, "Vertical vane position changed to: %s", this->vertical_vane_display_value_.c_str());
+  this->vertical_vane_position_ = position;
 
-  if (this->vertical_vane_select_ != nullptr) {
-    this->vertical_vane_select_->publish_state(this->vertical_vane_display_value_);
-  }
+  ESP_LOGD(TAG, "Vertical vane position changed to: %s", this->get_vertical_vane_label());
 
   this->update_swing_mode();
+  this->vertical_vane_callback_.call(position);
 }
 
 void DaewooAC::update_swing_mode() {
@@ -792,44 +1071,41 @@ void DaewooAC::update_swing_mode() {
   this->swing_mode = new_swing_mode;
   
   ESP_LOGD(TAG, "Swing mode updated to: %d (vertical: %s, horizontal: %s)", new_swing_mode,
-           this->vertical_vane_display_value_.c_str(), this->horizontal_swing_on_ ? "Swing" : "Static");
+           this->get_vertical_vane_label(), this->horizontal_swing_on_ ? "Swing" : "Static");
 }
 
 void DaewooAC::set_display_on(bool on) {
   if (this->display_on_ == on) {
     ESP_LOGD(TAG, "Display already %s", on ? "ON" : "OFF");
-  } else {
-    this->display_on_ = on;
-    ESP_LOGD(TAG, "Display state changed to: %s", on ? "ON" : "OFF");
+    return;
   }
 
-  if (this->display_switch_ != nullptr) {
-    this->display_switch_->publish_state(this->display_on_);
-  }
+  this->display_on_ = on;
+  ESP_LOGD(TAG, "Display state changed to: %s", on ? "ON" : "OFF");
+  this->display_callback_.call(on);
 }
 
 void DaewooAC::set_uv_light_on(bool on) {
   if (this->uv_light_on_ == on) {
     ESP_LOGD(TAG, "UV Light already %s", on ? "ON" : "OFF");
-  } else {
-    this->uv_light_on_ = on;
-    ESP_LOGD(TAG, "UV Light state changed to: %s", on ? "ON" : "OFF");
+    return;
   }
 
-  if (this->uv_light_switch_ != nullptr) {
-    this->uv_light_switch_->publish_state(this->uv_light_on_);
-  }
+  this->uv_light_on_ = on;
+  ESP_LOGD(TAG, "UV Light state changed to: %s", on ? "ON" : "OFF");
+  this->uv_light_callback_.call(on);
 }
 
 void DaewooAC::set_horizontal_swing_on(bool on) {
   if (this->horizontal_swing_on_ == on) {
     ESP_LOGD(TAG, "Horizontal swing already %s", on ? "ON" : "OFF");
-  } else {
-    this->horizontal_swing_on_ = on;
-    ESP_LOGD(TAG, "Horizontal swing state changed to: %s", on ? "ON" : "OFF");
+    return;
   }
 
+  this->horizontal_swing_on_ = on;
+  ESP_LOGD(TAG, "Horizontal swing state changed to: %s", on ? "ON" : "OFF");
   this->update_swing_mode();
+  this->horizontal_swing_callback_.call(on);
 }
 
 }  // namespace daewoo_ac
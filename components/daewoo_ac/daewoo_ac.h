@@ -1,18 +1,27 @@
 #pragma once
 
 #include <array>
-#include <vector>
 #include <string>
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/climate/climate.h"
-#include "esphome/components/select/select.h"
-#include "esphome/components/switch/switch.h"
 #include "esphome/components/uart/uart.h"
+#include "daewoo_ac_frame_parser.h"
+#include "daewoo_ac_link_stats.h"
+#include "daewoo_ac_mapping.h"
+#include "daewoo_ac_profiler.h"
+#include "daewoo_ac_protocol.h"
+#include "daewoo_ac_trace.h"
 
 namespace esphome {
 namespace daewoo_ac {
 
+class DaewooACBus;
+class DaewooACTestAccess;
+
 static constexpr uint8_t QUIET_FLAG_MASK = 0x01;
 static constexpr uint8_t DISPLAY_FLAG_MASK = 0x10;
 static constexpr uint8_t UV_LIGHT_FLAG_MASK = 0x02;
@@ -26,18 +35,59 @@ static constexpr uint8_t MAX_CURRENT_TEMPERATURE = 40;
 static constexpr size_t VERTICAL_VANE_OPTION_COUNT = 7;
 
 static constexpr uint32_t UPDATE_INTERVAL_DEFAULT_MILLIS = 2000;
+static constexpr uint32_t COMMAND_DEBOUNCE_DEFAULT_MILLIS = 50;
+// Delay between sending a command and the status poll that should confirm it
+static constexpr uint32_t COMMAND_CONFIRM_POLL_DELAY_MILLIS = 200;
+// Time to wait for confirmation of a command; doubles with every retransmission
+static constexpr uint32_t COMMAND_ACK_TIMEOUT_MILLIS = 1000;
+static constexpr uint8_t COMMAND_MAX_RETRIES = 3;
+// Line idle time, in character times, required before transmitting
+static constexpr uint8_t TX_IDLE_CHARS_DEFAULT = 4;
+// Minimum pause between a received frame and the next transmission
+static constexpr uint32_t TX_TURNAROUND_DEFAULT_MILLIS = 10;
+// First and largest interval of the fast polling burst used until the AC answers for the first time
+static constexpr uint32_t BOOT_POLL_MIN_INTERVAL_MILLIS = 250;
+static constexpr uint32_t BOOT_POLL_MAX_INTERVAL_MILLIS = 4000;
+// Mixed into the entity hash to tell the saved AC state apart from the climate's own preferences
+static constexpr uint32_t STATE_PREF_HASH = 0x44414557;
+
+
+// Decoded fields of the AC state, one bit each. All but the current temperature
+// can be changed from the UI and tracked in a dirty mask.
+enum DesiredField : uint8_t {
+  FIELD_MODE = 1 << 0,
+  FIELD_TARGET_TEMPERATURE = 1 << 1,
+  FIELD_FAN_MODE = 1 << 2,
+  FIELD_VERTICAL_VANE = 1 << 3,
+  FIELD_HORIZONTAL_SWING = 1 << 4,
+  FIELD_DISPLAY = 1 << 5,
+  FIELD_UV_LIGHT = 1 << 6,
+  FIELD_CURRENT_TEMPERATURE = 1 << 7,
+  // Everything but the room temperature, which drifts on its own
+  FIELDS_SETTINGS = 0x7F,
+  FIELDS_ALL = 0xFF,
+};
 
-// Length (in bytes) of Daewoo AC UART messages we care about
-static constexpr size_t MESSAGE_LENGTH = 22;
-
-enum class VerticalVanePosition : uint8_t {
-  SWING = 0,
-  UP = 1,
-  UP_MEDIUM = 2,
-  MEDIUM = 3,
-  MEDIUM_DOWN = 4,
-  DOWN = 5,
-  STATIC = 6,
+// Values requested from the UI. Only fields flagged in the dirty mask are meaningful.
+struct DesiredState {
+  climate::ClimateMode mode{climate::CLIMATE_MODE_OFF};
+  uint8_t target_temperature{MIN_TARGET_TEMPERATURE};
+  climate::ClimateFanMode fan_mode{climate::CLIMATE_FAN_AUTO};
+  VerticalVanePosition vertical_vane{VerticalVanePosition::STATIC};
+  bool horizontal_swing_on{false};
+  bool display_on{true};
+  bool uv_light_on{false};
+};
+
+// A set of changes applied together by DaewooAC::apply_state(). Unset fields are left alone.
+struct StateChange {
+  optional<climate::ClimateMode> mode;
+  optional<float> target_temperature;
+  optional<climate::ClimateFanMode> fan_mode;
+  optional<VerticalVanePosition> vertical_vane;
+  optional<bool> horizontal_swing;
+  optional<bool> display;
+  optional<bool> uv_light;
 };
 
 class DaewooAC : public climate::Climate, public Component {
@@ -47,17 +97,88 @@ class DaewooAC : public climate::Climate, public Component {
   void control(const climate::ClimateCall &call) override;
   climate::ClimateTraits traits() override;
 
-  // Queue a UI-originated change (property name and expected value).
-  // The queue only stores a limited history of recent changes.
+  // Request UI-originated changes. Each call overwrites the pending value of
+  // its field; all pending fields are merged into the next command frame.
+  void request_mode(climate::ClimateMode mode);
+  void request_target_temperature(float temperature);
+  void request_fan_mode(climate::ClimateFanMode fan_mode);
+  void request_vertical_vane(VerticalVanePosition position);
+  void request_horizontal_swing(bool on);
+  void request_display(bool on);
+  void request_uv_light(bool on);
+  // Queue every field set in `change` at once so they all go out in the same command
+  // frame, and show the new values right away as control() does.
+  void apply_state(const StateChange &change);
+  bool has_pending_changes() const { return this->dirty_fields_ != 0; }
+  // True if pending changes are due to be sent: the debounce window elapsed, or a power-off bypasses it.
+  bool has_command_ready(uint32_t now) const {
+    return this->has_pending_changes() &&
+           (this->send_immediately_ || now - this->dirty_since_ >= this->command_debounce_ms_);
+  }
+  // Number of commands abandoned after COMMAND_MAX_RETRIES unconfirmed retransmissions.
+  uint32_t get_failed_commit_count() const { return this->failed_commit_count_; }
+  // Time from the first transmission of the last confirmed command until the AC reported it back.
+  uint32_t get_last_confirm_latency_ms() const { return this->last_confirm_latency_ms_; }
+
+  // UART link health, read by the diagnostic sensors.
+  const FrameParserStats &get_rx_stats() const { return this->rx_parser_.stats(); }
+  uint32_t get_frames_sent() const { return this->frames_sent_; }
+  // Time from each status poll to the next valid frame, over the last RTT_SAMPLE_COUNT polls.
+  const LatencyWindow<RTT_SAMPLE_COUNT> &get_poll_rtt() const { return this->poll_rtt_; }
+  // Milliseconds since the last valid frame; false if none has been received yet.
+  bool get_last_frame_age(uint32_t *age_ms) const;
+
+  // String-based compatibility wrapper around the request_*() methods.
   void enqueue_ui_change(const std::string &property, const std::string &value);
 
   void set_update_interval(uint32_t update_interval_ms) { this->update_interval_ms_ = update_interval_ms; }
+  void set_command_debounce(uint32_t command_debounce_ms) { this->command_debounce_ms_ = command_debounce_ms; }
+  void set_immediate_power_off(bool immediate_power_off) { this->immediate_power_off_ = immediate_power_off; }
   void set_uart(uart::UARTComponent *uart) { this->uart_ = uart; }
-  void set_vertical_vane_select(select::Select *vertical_vane) { this->vertical_vane_select_ = vertical_vane; }
-  void set_display_switch(switch_::Switch *display_switch) { this->display_switch_ = display_switch; }
-  void set_uv_light_switch(switch_::Switch *uv_light_switch) { this->uv_light_switch_ = uv_light_switch; }
+  void set_tx_idle_chars(uint8_t tx_idle_chars) { this->tx_idle_chars_ = tx_idle_chars; }
+  void set_tx_turnaround(uint32_t tx_turnaround_ms) { this->tx_turnaround_ms_ = tx_turnaround_ms; }
+  // Hand TX scheduling over to a bus shared with other units.
+  void set_bus(DaewooACBus *bus) { this->bus_ = bus; }
+  // Poll between `min_interval_ms` and `max_interval_ms` instead of at update_interval:
+  // fast after a command or a state change, doubling while status frames stay identical.
+  void set_adaptive_polling(uint32_t min_interval_ms, uint32_t max_interval_ms) {
+    this->adaptive_polling_ = true;
+    this->min_update_interval_ms_ = min_interval_ms;
+    this->max_update_interval_ms_ = max_interval_ms;
+    this->adaptive_interval_ms_ = min_interval_ms;
+  }
+  uint32_t get_poll_interval() const {
+    if (this->adaptive_polling_) {
+      return this->adaptive_interval_ms_;
+    }
+    return this->update_interval_ms_ > 0 ? this->update_interval_ms_ : UPDATE_INTERVAL_DEFAULT_MILLIS;
+  }
+  // Move the next regular poll `delay_ms` from now; later polls keep that phase.
+  void schedule_next_poll(uint32_t delay_ms);
+  bool has_received_frame() const { return this->has_received_frame_; }
+  // Replace the millisecond clock used for all scheduling (defaults to millis()).
+  // All intervals are compared as `now - start`, so clock wraparound is harmless.
+  void set_time_source(uint32_t (*time_source)()) { this->time_source_ = time_source; }
 
-  const std::string &get_vertical_vane_display_value() const { return this->vertical_vane_display_value_; }
+  // Subscribe to individual fields. Each callback fires exactly once per actual change,
+  // whether it came from the AC or from another entity.
+  void add_on_vertical_vane_callback(std::function<void(VerticalVanePosition)> &&callback) {
+    this->vertical_vane_callback_.add(std::move(callback));
+  }
+  void add_on_display_callback(std::function<void(bool)> &&callback) {
+    this->display_callback_.add(std::move(callback));
+  }
+  void add_on_uv_light_callback(std::function<void(bool)> &&callback) {
+    this->uv_light_callback_.add(std::move(callback));
+  }
+  void add_on_horizontal_swing_callback(std::function<void(bool)> &&callback) {
+    this->horizontal_swing_callback_.add(std::move(callback));
+  }
+
+  // Label of the current position; points at the select's option or a built-in default, never freed.
+  const char *get_vertical_vane_label() const {
+    return this->vertical_vane_labels_[static_cast<size_t>(this->vertical_vane_position_)];
+  }
   VerticalVanePosition get_vertical_vane_position_state() const { return this->vertical_vane_position_; }
   bool is_display_on() const { return this->display_on_; }
   bool is_uv_light_on() const { return this->uv_light_on_; }
@@ -71,54 +192,147 @@ class DaewooAC : public climate::Climate, public Component {
   
   void update_swing_mode();
 
- private:
- struct UiChangeEntry {
-  std::string property;
-  std::string value;
-};
+#ifdef USE_DAEWOO_AC_TRACE
+  // Number of raw UART records to keep for dump_trace(); the buffer is allocated in setup().
+  void set_trace_buffer_size(size_t records) { this->trace_buffer_size_ = records; }
+  // Log every record held in the trace buffer, oldest first, in the format read by
+  // tools/daewoo_ac_replay.cpp. With `clear` the next dump starts a fresh capture.
+  void dump_trace(bool clear = false);
+#endif
+#ifdef USE_DAEWOO_AC_PROFILER
+  // Log average and maximum time per loop() stage, optionally starting a new measurement.
+  void dump_profile(bool reset = false);
+  const LoopProfiler &get_profiler() const { return this->profiler_; }
+#endif
 
-struct DaewooState {
-  uint8_t operation;           // 0x01 for read operation, 0x02 for write operation
-  uint8_t power_state;         // done
-  uint8_t reserved0;
-  uint8_t vertical_vane;       // done
-  uint8_t flags0;
-  uint8_t mode;                // done
-  uint8_t flags1;              // bits 1, 2, 5 - done
-  uint8_t fan_mode;            // done
-  uint8_t target_temperature;  // done
-  uint8_t current_temperature; // done
-  uint8_t reserved1[9];
-  uint8_t checksum;            // done
-};
+ private:
+  // The host tests and benchmarks in tests/ drive the private decode and encode steps directly.
+  friend class DaewooACTestAccess;
 
   // Build a Daewoo UART command frame representing the desired state.
   // The frame is based on the last known Daewoo state (`daewoo_state_`)
-  // with all pending UI changes from `ui_change_queue_` applied on top.
-  // The returned array always has length `MESSAGE_LENGTH` (22 bytes),
+  // with all dirty fields of `desired_state_` applied on top.
+  // The returned frame always has length `MESSAGE_LENGTH` (22 bytes),
   // starts with 0xAA 0x14 and ends with a valid checksum byte.
-  std::array<uint8_t, MESSAGE_LENGTH> build_command_frame_from_state_();
+  Frame<MESSAGE_LENGTH> build_command_frame_from_state_();
+
+  // Encode the `fields` subset of `desired_state_` into a mutable DaewooState instance.
+  void apply_desired_state_(DaewooState &state, uint8_t fields) const;
+
+  // Flag `fields` as pending for the next command frame.
+  void mark_dirty_(uint8_t fields);
 
-  // Apply a single UI change entry to a mutable DaewooState instance.
-  void apply_ui_change_to_state_(DaewooState &state, const UiChangeEntry &change) const;
+  // Return the DesiredField mask of fields that are encoded identically in `a` and `b`.
+  static uint8_t matching_fields_(const DaewooState &a, const DaewooState &b);
+
+  // Clear every unconfirmed field that the latest `daewoo_state_` reports as commanded.
+  void confirm_command_();
+
+  // Retransmit unconfirmed fields once their confirmation timed out, or give up after
+  // COMMAND_MAX_RETRIES attempts.
+  void check_command_timeout_(uint32_t now);
+
+  uint32_t now_() const { return this->time_source_(); }
+
+  // False while a frame is arriving, the line has not been quiet for `tx_idle_ms_`,
+  // or the last frame arrived less than `tx_turnaround_ms_` ago.
+  bool line_idle_(uint32_t now) const;
+
+  // Write a raw frame to the UART and trace it.
+  void write_frame_(const uint8_t *data, size_t len);
+
+  // Record bytes in the trace buffer exactly as they crossed the wire.
+  void trace_bytes_(TraceDirection direction, const uint8_t *data, size_t len);
+  // Log a frame as hex when verbose logging is compiled in.
+  template<typename Bytes> void log_frame_(TraceDirection direction, const Bytes &bytes, size_t offset, size_t len);
+
+  // Load the AC state saved before the last reboot and decode it into the entity state.
+  void restore_state_();
+  // Save the last decoded state once one of the restorable fields (all but the room
+  // temperature) differs from the saved one.
+  void save_state_if_changed_();
+
+  // Restart adaptive polling at its minimum interval, or back off after an unchanged frame.
+  void adapt_poll_interval_(bool changed);
+
+  // Log display, UV light and vane state below a climate state change.
+  void log_auxiliary_state_();
 
   // Last known raw Daewoo state as received over UART.
   DaewooState daewoo_state_{};
+  // Payload the entity state was last decoded from
+  DaewooState synced_state_{};
+  bool has_synced_state_{false};
 
   // Timestamp of the last periodic update
   uint32_t last_update_{0};
+  // Poll on the first loop() instead of waiting a full interval
+  bool poll_at_boot_{true};
+  // Current interval of the boot burst; doubles after every unanswered poll
+  uint32_t boot_poll_interval_{BOOT_POLL_MIN_INTERVAL_MILLIS};
+
+  // Last known state kept in flash across reboots
+  ESPPreferenceObject state_pref_;
+  DaewooState saved_state_{};
+  bool has_saved_state_{false};
+  // State of the last save that failed; not retried until a setting changes
+  DaewooState failed_save_state_{};
+  bool save_failed_{false};
+
+  // Link health counters
+  uint32_t frames_sent_{0};
+  uint32_t last_frame_at_{0};
+  bool has_received_frame_{false};
+  // Set while a status poll is waiting for its response
+  bool poll_outstanding_{false};
+  uint32_t poll_sent_at_{0};
+  LatencyWindow<RTT_SAMPLE_COUNT> poll_rtt_;
+
+  // Assembles UART responses from the receive ring without blocking or allocating
+  FrameParser rx_parser_;
+#ifdef USE_DAEWOO_AC_TRACE
+  size_t trace_buffer_size_{0};
+  FrameTrace trace_;
+#endif
+#ifdef USE_DAEWOO_AC_PROFILER
+  // CPU cycle counter, or micros() on the host platform
+  static uint32_t profiler_ticks_();
+  static uint32_t profiler_ticks_per_us_();
+  LoopProfiler profiler_{&DaewooAC::profiler_ticks_, profiler_ticks_per_us_()};
+#endif
 
-  // Simple receive buffer for assembling UART responses without blocking
-  std::vector<uint8_t> uart_rx_buffer_;
+  // Latest UI-requested values and the DesiredField mask of those not yet sent.
+  DesiredState desired_state_{};
+  uint8_t dirty_fields_{0};
+  // Fields to decode from the next frame even if its bytes did not change: touched
+  // locally, or held back while their write was in flight
+  uint8_t resync_fields_{0};
+  // Timestamp of the change that made `dirty_fields_` non-zero; opens the debounce window
+  uint32_t dirty_since_{0};
+  // Set by a power-off request to bypass the debounce window
+  bool send_immediately_{false};
 
-  // Bounded FIFO queue of recent UI-driven changes.
-  static constexpr size_t UI_CHANGE_QUEUE_MAX_SIZE = 50;
-  std::vector<UiChangeEntry> ui_change_queue_;
+  // Fields of the last command frame the AC has not reported back yet, and that frame's payload
+  uint8_t unconfirmed_fields_{0};
+  DaewooState commanded_state_{};
+  uint32_t command_started_at_{0};
+  uint32_t command_sent_at_{0};
+  uint8_t command_retries_{0};
+  bool confirm_poll_pending_{false};
+  uint32_t failed_commit_count_{0};
+  uint32_t last_confirm_latency_ms_{0};
 
-  // Parse raw UART bytes into framed messages and dispatch valid ones.
-  void parse_uart_response_(const std::vector<uint8_t> &buffer);
+  // Run the frame parser over received bytes and log what it had to discard.
+  void process_rx_buffer_();
 
-  void sync_daewoo_state();
+  // Decode a single validated frame and dispatch it to the state sync.
+  // `frame` points into the parser's receive ring and is only valid during the call.
+  void parse_uart_response_(const FrameParser::View &frame);
+
+  // Decode the `fields` subset of `daewoo_state_` into the entity state and publish what changed.
+  void sync_daewoo_state(uint8_t fields);
+  // Decode without publishing; returns whether any entity value changed.
+  bool decode_daewoo_state_(uint8_t fields);
 
  protected:
   // Mock state variables
@@ -127,21 +341,38 @@ struct DaewooState {
   climate::ClimateMode current_mode_{climate::CLIMATE_MODE_OFF};
   climate::ClimateFanMode current_fan_mode_{climate::CLIMATE_FAN_AUTO};
   uint32_t update_interval_ms_{UPDATE_INTERVAL_DEFAULT_MILLIS};
+  bool adaptive_polling_{false};
+  uint32_t min_update_interval_ms_{UPDATE_INTERVAL_DEFAULT_MILLIS};
+  uint32_t max_update_interval_ms_{UPDATE_INTERVAL_DEFAULT_MILLIS};
+  // Current adaptive poll interval, between the two bounds above
+  uint32_t adaptive_interval_ms_{UPDATE_INTERVAL_DEFAULT_MILLIS};
+  uint32_t command_debounce_ms_{COMMAND_DEBOUNCE_DEFAULT_MILLIS};
+  bool immediate_power_off_{true};
+  uint8_t tx_idle_chars_{TX_IDLE_CHARS_DEFAULT};
+  uint32_t tx_turnaround_ms_{TX_TURNAROUND_DEFAULT_MILLIS};
+  // `tx_idle_chars_` converted to milliseconds at the UART's frame format and baud rate
+  uint32_t tx_idle_ms_{1};
   uart::UARTComponent *uart_{nullptr};
-  switch_::Switch *display_switch_{nullptr};
-  switch_::Switch *uv_light_switch_{nullptr};
-  
+  DaewooACBus *bus_{nullptr};
+  uint32_t (*time_source_)(){&millis};
+  CallbackManager<void(VerticalVanePosition)> vertical_vane_callback_;
+  CallbackManager<void(bool)> display_callback_;
+  CallbackManager<void(bool)> uv_light_callback_;
+  CallbackManager<void(bool)> horizontal_swing_callback_;
+
   // Vane position selectors
-  select::Select *vertical_vane_select_{nullptr};
-  std::array<std::string, VERTICAL_VANE_OPTION_COUNT> vertical_vane_labels_{
+  // Indexed by VerticalVanePosition. The pointers reference string literals or the
+  // select's option list, both of which live for the whole program.
+  std::array<const char *, VERTICAL_VANE_OPTION_COUNT> vertical_vane_labels_{
       {"Swing", "Up", "Up & Medium", "Medium", "Medium & Down", "Down", "Static"}};
   VerticalVanePosition vertical_vane_position_{VerticalVanePosition::STATIC};
-  std::string vertical_vane_display_value_{"Static"};
   bool display_on_{true};
   bool uv_light_on_{false};
   bool horizontal_swing_on_{false};
 
   void apply_vertical_vane_position(VerticalVanePosition position);
+  // Resolve `label` to its position; false if no label matches.
+  bool find_vertical_vane_label_(const char *label, VerticalVanePosition *position) const;
 };
 
 }  // namespace daewoo_ac
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "daewoo_ac.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Templatable fields shared by the actions that change several fields at once.
+template<typename... Ts> class StateChangeAction : public Action<Ts...> {
+ public:
+  TEMPLATABLE_VALUE(climate::ClimateMode, mode)
+  TEMPLATABLE_VALUE(float, target_temperature)
+  TEMPLATABLE_VALUE(climate::ClimateFanMode, fan_mode)
+  TEMPLATABLE_VALUE(VerticalVanePosition, vertical_vane)
+  TEMPLATABLE_VALUE(bool, horizontal_swing)
+  TEMPLATABLE_VALUE(bool, display)
+  TEMPLATABLE_VALUE(bool, uv_light)
+
+ protected:
+  StateChange make_change_(Ts... x) {
+    StateChange change;
+    if (this->mode_.has_value())
+      change.mode = this->mode_.value(x...);
+    if (this->target_temperature_.has_value())
+      change.target_temperature = this->target_temperature_.value(x...);
+    if (this->fan_mode_.has_value())
+      change.fan_mode = this->fan_mode_.value(x...);
+    if (this->vertical_vane_.has_value())
+      change.vertical_vane = this->vertical_vane_.value(x...);
+    if (this->horizontal_swing_.has_value())
+      change.horizontal_swing = this->horizontal_swing_.value(x...);
+    if (this->display_.has_value())
+      change.display = this->display_.value(x...);
+    if (this->uv_light_.has_value())
+      change.uv_light = this->uv_light_.value(x...);
+    return change;
+  }
+};
+
+// Applies any subset of fields to one unit in a single command frame.
+template<typename... Ts> class ApplyStateAction : public StateChangeAction<Ts...> {
+ public:
+  explicit ApplyStateAction(DaewooAC *parent) : parent_(parent) {}
+
+  void play(Ts... x) override { this->parent_->apply_state(this->make_change_(x...)); }
+
+ protected:
+  DaewooAC *parent_;
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
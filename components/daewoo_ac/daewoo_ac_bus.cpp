@@ -0,0 +1,87 @@
+#include "daewoo_ac_bus.h"
+#include <algorithm>
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+static const char *const TAG = "daewoo_ac.bus";
+
+// Longest gap credited to the token bucket at once; keeps the refill product in range
+static constexpr uint32_t BUS_MAX_REFILL_MILLIS = 60000;
+
+void DaewooACBus::add_unit(DaewooAC *unit) {
+  if (this->units_.size() >= BUS_MAX_UNITS) {
+    ESP_LOGE(TAG, "A bus coordinates at most %u units; ignoring the rest", BUS_MAX_UNITS);
+    return;
+  }
+  unit->set_bus(this);
+  this->units_.push_back(unit);
+}
+
+void DaewooACBus::setup() {
+  uint32_t now = this->now_();
+  this->epoch_ = now;
+  this->last_refill_ = now;
+  this->tokens_milli_ = this->units_.size() * 1000;
+}
+
+void DaewooACBus::dump_config() {
+  ESP_LOGCONFIG(TAG, "Daewoo AC bus:");
+  ESP_LOGCONFIG(TAG, "  Units: %u", this->units_.size());
+  ESP_LOGCONFIG(TAG, "  TX budget: %u frames/s", this->tx_budget_);
+}
+
+void DaewooACBus::loop() {
+  uint32_t now = this->now_();
+  // Units poll in a fast burst until they first answer; only then do they get their slot.
+  // Adaptive polling changes the interval, and the slot grid with it, so re-align after every change.
+  for (size_t i = 0; i < this->units_.size(); ++i) {
+    DaewooAC *unit = this->units_[i];
+    if (unit->has_received_frame() && unit->get_poll_interval() != this->aligned_interval_[i]) {
+      this->align_poll_slot_(i, now);
+    }
+  }
+}
+
+void DaewooACBus::align_poll_slot_(size_t index, uint32_t now) {
+  // Unit i polls at epoch + i * interval / N + k * interval.
+  uint32_t interval = this->units_[index]->get_poll_interval();
+  this->aligned_interval_[index] = interval;
+  if (interval == 0) {
+    return;
+  }
+  uint32_t offset = static_cast<uint32_t>(static_cast<uint64_t>(interval) * index / this->units_.size());
+  uint32_t since_slot = ((now - this->epoch_) % interval + interval - offset) % interval;
+  uint32_t delay = interval - since_slot;
+  ESP_LOGD(TAG, "Unit %u polls every %u ms at offset %u ms; next poll in %u ms", index, interval, offset, delay);
+  this->units_[index]->schedule_next_poll(delay);
+}
+
+void DaewooACBus::refill_(uint32_t now) {
+  uint32_t elapsed = std::min(now - this->last_refill_, BUS_MAX_REFILL_MILLIS);
+  this->last_refill_ = now;
+  uint32_t capacity = this->units_.size() * 1000;
+  // tx_budget_ frames per second is tx_budget_ thousandths of a frame per millisecond.
+  this->tokens_milli_ = std::min(capacity, this->tokens_milli_ + elapsed * this->tx_budget_);
+}
+
+bool DaewooACBus::acquire_tx(bool command, uint32_t now) {
+  this->refill_(now);
+  if (this->tokens_milli_ < 1000) {
+    return false;
+  }
+  if (!command) {
+    for (DaewooAC *unit : this->units_) {
+      if (unit->has_command_ready(now)) {
+        return false;
+      }
+    }
+  }
+  this->tokens_milli_ -= 1000;
+  return true;
+}
+
+}  // namespace daewoo_ac
+}  // namespace esphome
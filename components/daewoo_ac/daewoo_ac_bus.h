@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "daewoo_ac.h"
+#include "daewoo_ac_automation.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Default number of frames all units together may send per second
+static constexpr uint32_t BUS_TX_BUDGET_DEFAULT = 10;
+
+// Largest number of units one bus can coordinate
+static constexpr size_t BUS_MAX_UNITS = 32;
+
+// Coordinates several DaewooAC units on one node: it spreads their status polls
+// evenly over the update interval and shares one TX budget between them, giving
+// pending commands precedence over polls. Each unit still needs its own UART.
+class DaewooACBus : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void add_unit(DaewooAC *unit);
+  // Frames per second shared by all units
+  void set_tx_budget(uint32_t frames_per_second) { this->tx_budget_ = frames_per_second; }
+
+  // Called by a unit before every transmission. Commands are granted whenever a token is
+  // left; polls only if no unit is waiting to send a command. Consumes a token on success.
+  bool acquire_tx(bool command, uint32_t now);
+
+  const std::vector<DaewooAC *> &get_units() const { return this->units_; }
+  // Replace the millisecond clock used for slots and the budget (defaults to millis()).
+  void set_time_source(uint32_t (*time_source)()) { this->time_source_ = time_source; }
+
+ protected:
+  void refill_(uint32_t now);
+  void align_poll_slot_(size_t index, uint32_t now);
+  uint32_t now_() const { return this->time_source_(); }
+
+  std::vector<DaewooAC *> units_;
+  // Interval unit i was last given a slot for; 0 until it first answers
+  uint32_t aligned_interval_[BUS_MAX_UNITS]{};
+  uint32_t tx_budget_{BUS_TX_BUDGET_DEFAULT};
+  // Token bucket in thousandths of a frame; holds at most one frame per unit
+  uint32_t tokens_milli_{0};
+  uint32_t last_refill_{0};
+  // Common origin of all poll slots
+  uint32_t epoch_{0};
+  uint32_t (*time_source_)(){&millis};
+};
+
+template<typename... Ts> class GroupControlAction : public StateChangeAction<Ts...> {
+ public:
+  explicit GroupControlAction(DaewooACBus *bus) : bus_(bus) {}
+
+  // Every unit opens its debounce window in this call and gets all fields in one
+  // command frame, so the whole group switches in the same scheduling round.
+  void play(Ts... x) override {
+    StateChange change = this->make_change_(x...);
+    for (DaewooAC *unit : this->bus_->get_units())
+      unit->apply_state(change);
+  }
+
+ protected:
+  DaewooACBus *bus_;
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
@@ -13,23 +13,14 @@ void DaewooACDisplaySwitch::setup() {
   }
 
   bool initial_state = this->parent_->is_display_on();
-  this->last_reported_state_ = initial_state;
 
   ESP_LOGCONFIG(TAG, "Setting up Display Toggle (initial state: %s)", initial_state ? "ON" : "OFF");
   this->publish_state(initial_state);
-}
-
-void DaewooACDisplaySwitch::loop() {
-  if (this->parent_ == nullptr) {
-    return;
-  }
 
-  bool parent_state = this->parent_->is_display_on();
-  if (parent_state != this->last_reported_state_) {
-    this->last_reported_state_ = parent_state;
-    ESP_LOGD(TAG, "Display state synced from AC: %s", parent_state ? "ON" : "OFF");
-    this->publish_state(parent_state);
-  }
+  this->parent_->add_on_display_callback([this](bool on) {
+    ESP_LOGD(TAG, "Display state updated: %s", on ? "ON" : "OFF");
+    this->publish_state(on);
+  });
 }
 
 void DaewooACDisplaySwitch::write_state(bool state) {
@@ -38,18 +29,18 @@ void DaewooACDisplaySwitch::write_state(bool state) {
     return;
   }
 
-  if (state == this->last_reported_state_) {
+  this->parent_->request_display(state);
+
+  if (this->parent_->is_display_on() == state) {
+    // The parent will not notify about an unchanged value; acknowledge directly.
     ESP_LOGD(TAG, "Display already %s", state ? "ON" : "OFF");
+    this->publish_state(state);
     return;
   }
 
-  this->parent_->enqueue_ui_change("display_on", state ? "true" : "false");
   this->parent_->set_display_on(state);
-  this->last_reported_state_ = state;
-  this->publish_state(state);
 }
 
 }  // namespace daewoo_ac
 }  // namespace esphome
 
-
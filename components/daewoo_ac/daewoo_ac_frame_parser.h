@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "daewoo_ac_protocol.h"
+#include "daewoo_ac_ring_buffer.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Maximum silence between two bytes of one frame before a partial frame is dropped
+static constexpr uint32_t RX_FRAME_TIMEOUT_MILLIS = 50;
+// Capacity of the UART receive ring; must hold at least two full frames
+static constexpr size_t RX_BUFFER_SIZE = 64;
+static_assert(RX_BUFFER_SIZE >= 2 * MESSAGE_LENGTH, "RX_BUFFER_SIZE must hold at least two frames");
+
+// Running totals of everything the parser rejected or accepted since boot.
+struct FrameParserStats {
+  uint32_t frames{0};
+  uint32_t length_errors{0};
+  uint32_t checksum_errors{0};
+  uint32_t bytes_discarded{0};
+  // process() runs that had to skip bytes to find the next frame boundary
+  uint32_t resyncs{0};
+  uint32_t timeouts{0};
+};
+
+// Incremental, self-resynchronizing framer for the Daewoo UART stream.
+// It only depends on the protocol headers, so it can be driven with plain
+// byte arrays and timestamps outside of ESPHome.
+class FrameParser {
+ public:
+  using Buffer = RingBuffer<RX_BUFFER_SIZE>;
+  using View = Buffer::View;
+
+  // Largest contiguous free region of the receive ring. Fill it, then call commit().
+  uint8_t *write_region(size_t *len) { return this->buffer_.write_region(len); }
+  void commit(size_t len, uint32_t now) {
+    this->buffer_.commit(len);
+    this->last_byte_at_ = now;
+  }
+
+  // Hand every complete frame in the ring to `on_frame(const View &)`, sliding one
+  // byte forward whenever the header, length byte or checksum does not match.
+  // Bytes of an incomplete trailing frame are kept. Returns the bytes discarded.
+  template<typename Handler> size_t process(Handler &&on_frame) {
+    const Buffer &buffer = this->buffer_;
+    size_t pos = 0;
+    size_t discarded = 0;
+
+    while (pos < buffer.size()) {
+      // Hunt for the frame header.
+      if (buffer[pos] != FRAME_HEADER) {
+        ++pos;
+        ++discarded;
+        continue;
+      }
+
+      // Wait for the length byte.
+      if (buffer.size() - pos < 2) {
+        break;
+      }
+
+      if (buffer[pos + 1] + 2U != MESSAGE_LENGTH) {
+        ++this->stats_.length_errors;
+        ++pos;
+        ++discarded;
+        continue;
+      }
+
+      // Wait for the rest of the frame.
+      if (buffer.size() - pos < MESSAGE_LENGTH) {
+        break;
+      }
+
+      // Validate checksum: sum of all bytes except the last, modulo 256, must equal the last byte.
+      // On mismatch the 0xAA we locked onto may have been payload; slide past it and rescan.
+      if (frame_checksum(buffer, pos, MESSAGE_LENGTH - 1) != buffer[pos + MESSAGE_LENGTH - 1]) {
+        ++this->stats_.checksum_errors;
+        ++pos;
+        ++discarded;
+        continue;
+      }
+
+      ++this->stats_.frames;
+      on_frame(buffer.view(pos, MESSAGE_LENGTH));
+      pos += MESSAGE_LENGTH;
+    }
+
+    if (discarded > 0) {
+      ++this->stats_.resyncs;
+      this->stats_.bytes_discarded += discarded;
+    }
+    this->buffer_.discard(pos);
+    return discarded;
+  }
+
+  // Drop a partial frame once the line has been quiet for RX_FRAME_TIMEOUT_MILLIS.
+  // Returns the number of bytes dropped.
+  size_t expire(uint32_t now) {
+    if (this->buffer_.empty() || now - this->last_byte_at_ <= RX_FRAME_TIMEOUT_MILLIS) {
+      return 0;
+    }
+    size_t dropped = this->buffer_.size();
+    this->buffer_.clear();
+    ++this->stats_.timeouts;
+    this->stats_.bytes_discarded += dropped;
+    return dropped;
+  }
+
+  // Bytes received but not yet consumed as part of a frame.
+  size_t pending() const { return this->buffer_.size(); }
+  uint32_t last_byte_at() const { return this->last_byte_at_; }
+  const FrameParserStats &stats() const { return this->stats_; }
+
+ protected:
+  Buffer buffer_;
+  uint32_t last_byte_at_{0};
+  FrameParserStats stats_{};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
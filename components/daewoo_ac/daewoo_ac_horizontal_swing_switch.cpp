@@ -13,23 +13,14 @@ void DaewooACHorizontalSwingSwitch::setup() {
   }
 
   bool initial_state = this->parent_->is_horizontal_swing_on();
-  this->last_reported_state_ = initial_state;
 
   ESP_LOGCONFIG(TAG, "Setting up Horizontal Swing Toggle (initial state: %s)", initial_state ? "ON" : "OFF");
   this->publish_state(initial_state);
-}
-
-void DaewooACHorizontalSwingSwitch::loop() {
-  if (this->parent_ == nullptr) {
-    return;
-  }
 
-  bool parent_state = this->parent_->is_horizontal_swing_on();
-  if (parent_state != this->last_reported_state_) {
-    this->last_reported_state_ = parent_state;
-    ESP_LOGD(TAG, "Horizontal swing state synced from AC: %s", parent_state ? "ON" : "OFF");
-    this->publish_state(parent_state);
-  }
+  this->parent_->add_on_horizontal_swing_callback([this](bool on) {
+    ESP_LOGD(TAG, "Horizontal swing state updated: %s", on ? "ON" : "OFF");
+    this->publish_state(on);
+  });
 }
 
 void DaewooACHorizontalSwingSwitch::write_state(bool state) {
@@ -38,16 +29,16 @@ void DaewooACHorizontalSwingSwitch::write_state(bool state) {
     return;
   }
 
-  if (state == this->last_reported_state_) {
+  this->parent_->request_horizontal_swing(state);
+
+  if (this->parent_->is_horizontal_swing_on() == state) {
+    // The parent will not notify about an unchanged value; acknowledge directly.
     ESP_LOGD(TAG, "Horizontal swing already %s", state ? "ON" : "OFF");
+    this->publish_state(state);
     return;
   }
 
-  this->parent_->enqueue_ui_change("horizontal_swing_on", state ? "true" : "false");
   this->parent_->set_horizontal_swing_on(state);
-
-  this->last_reported_state_ = state;
-  this->publish_state(state);
 }
 
 }  // namespace daewoo_ac
@@ -10,14 +10,12 @@ namespace daewoo_ac {
 class DaewooACHorizontalSwingSwitch : public switch_::Switch, public Component {
  public:
   void setup() override;
-  void loop() override;
   void set_parent(DaewooAC *parent) { this->parent_ = parent; }
 
  protected:
   void write_state(bool state) override;
 
   DaewooAC *parent_{nullptr};
-  bool last_reported_state_{false};
 };
 
 }  // namespace daewoo_ac
@@ -0,0 +1,58 @@
+#include "daewoo_ac_link_sensor.h"
+#include <cmath>
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+static const char *const TAG = "daewoo_ac.link_sensor";
+
+void DaewooACLinkSensor::setup() {
+  if (this->parent_ == nullptr) {
+    ESP_LOGE(TAG, "Parent not set for link sensors during setup");
+    this->mark_failed();
+    return;
+  }
+  ESP_LOGCONFIG(TAG, "Setting up UART link sensors");
+}
+
+void DaewooACLinkSensor::update() {
+  if (this->parent_ == nullptr) {
+    return;
+  }
+
+  const FrameParserStats &rx = this->parent_->get_rx_stats();
+  if (this->frames_sent_sensor_ != nullptr)
+    this->frames_sent_sensor_->publish_state(this->parent_->get_frames_sent());
+  if (this->frames_received_sensor_ != nullptr)
+    this->frames_received_sensor_->publish_state(rx.frames);
+  if (this->checksum_errors_sensor_ != nullptr)
+    this->checksum_errors_sensor_->publish_state(rx.checksum_errors);
+  if (this->length_errors_sensor_ != nullptr)
+    this->length_errors_sensor_->publish_state(rx.length_errors);
+  if (this->resyncs_sensor_ != nullptr)
+    this->resyncs_sensor_->publish_state(rx.resyncs);
+  if (this->bytes_discarded_sensor_ != nullptr)
+    this->bytes_discarded_sensor_->publish_state(rx.bytes_discarded);
+  if (this->failed_commits_sensor_ != nullptr)
+    this->failed_commits_sensor_->publish_state(this->parent_->get_failed_commit_count());
+
+  // Latency gauges stay unknown until the first poll has been answered.
+  const auto &rtt = this->parent_->get_poll_rtt();
+  if (this->poll_rtt_min_sensor_ != nullptr)
+    this->poll_rtt_min_sensor_->publish_state(rtt.empty() ? NAN : rtt.min());
+  if (this->poll_rtt_avg_sensor_ != nullptr)
+    this->poll_rtt_avg_sensor_->publish_state(rtt.empty() ? NAN : rtt.average());
+  if (this->poll_rtt_p95_sensor_ != nullptr)
+    this->poll_rtt_p95_sensor_->publish_state(rtt.empty() ? NAN : rtt.percentile(95));
+  if (this->poll_interval_sensor_ != nullptr)
+    this->poll_interval_sensor_->publish_state(this->parent_->get_poll_interval());
+
+  if (this->last_frame_age_sensor_ != nullptr) {
+    uint32_t age_ms;
+    this->last_frame_age_sensor_->publish_state(this->parent_->get_last_frame_age(&age_ms) ? age_ms / 1000.0f : NAN);
+  }
+}
+
+}  // namespace daewoo_ac
+}  // namespace esphome
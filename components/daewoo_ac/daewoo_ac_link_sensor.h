@@ -0,0 +1,49 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include "daewoo_ac.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Periodically publishes the UART link health counters of a DaewooAC.
+// Every sensor is optional; unset ones are skipped.
+class DaewooACLinkSensor : public PollingComponent {
+ public:
+  void setup() override;
+  void update() override;
+  void set_parent(DaewooAC *parent) { this->parent_ = parent; }
+
+  void set_frames_sent_sensor(sensor::Sensor *sensor) { this->frames_sent_sensor_ = sensor; }
+  void set_frames_received_sensor(sensor::Sensor *sensor) { this->frames_received_sensor_ = sensor; }
+  void set_checksum_errors_sensor(sensor::Sensor *sensor) { this->checksum_errors_sensor_ = sensor; }
+  void set_length_errors_sensor(sensor::Sensor *sensor) { this->length_errors_sensor_ = sensor; }
+  void set_resyncs_sensor(sensor::Sensor *sensor) { this->resyncs_sensor_ = sensor; }
+  void set_bytes_discarded_sensor(sensor::Sensor *sensor) { this->bytes_discarded_sensor_ = sensor; }
+  void set_failed_commits_sensor(sensor::Sensor *sensor) { this->failed_commits_sensor_ = sensor; }
+  void set_poll_rtt_min_sensor(sensor::Sensor *sensor) { this->poll_rtt_min_sensor_ = sensor; }
+  void set_poll_rtt_avg_sensor(sensor::Sensor *sensor) { this->poll_rtt_avg_sensor_ = sensor; }
+  void set_poll_rtt_p95_sensor(sensor::Sensor *sensor) { this->poll_rtt_p95_sensor_ = sensor; }
+  void set_last_frame_age_sensor(sensor::Sensor *sensor) { this->last_frame_age_sensor_ = sensor; }
+  void set_poll_interval_sensor(sensor::Sensor *sensor) { this->poll_interval_sensor_ = sensor; }
+
+ protected:
+  DaewooAC *parent_{nullptr};
+
+  sensor::Sensor *frames_sent_sensor_{nullptr};
+  sensor::Sensor *frames_received_sensor_{nullptr};
+  sensor::Sensor *checksum_errors_sensor_{nullptr};
+  sensor::Sensor *length_errors_sensor_{nullptr};
+  sensor::Sensor *resyncs_sensor_{nullptr};
+  sensor::Sensor *bytes_discarded_sensor_{nullptr};
+  sensor::Sensor *failed_commits_sensor_{nullptr};
+  sensor::Sensor *poll_rtt_min_sensor_{nullptr};
+  sensor::Sensor *poll_rtt_avg_sensor_{nullptr};
+  sensor::Sensor *poll_rtt_p95_sensor_{nullptr};
+  sensor::Sensor *last_frame_age_sensor_{nullptr};
+  sensor::Sensor *poll_interval_sensor_{nullptr};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
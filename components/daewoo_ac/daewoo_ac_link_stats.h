@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Number of poll round-trip samples kept for the latency statistics
+static constexpr size_t RTT_SAMPLE_COUNT = 32;
+
+// Sliding window of the most recent `N` latency samples in milliseconds.
+// Adding a sample is O(1); the statistics are computed on demand by readers.
+template<size_t N> class LatencyWindow {
+  static_assert(N > 0, "LatencyWindow needs room for at least one sample");
+
+ public:
+  void add(uint32_t sample) {
+    this->samples_[this->next_] = sample;
+    this->next_ = (this->next_ + 1) % N;
+    if (this->count_ < N) {
+      ++this->count_;
+    }
+  }
+
+  size_t size() const { return this->count_; }
+  bool empty() const { return this->count_ == 0; }
+  void clear() {
+    this->next_ = 0;
+    this->count_ = 0;
+  }
+
+  // All statistics return 0 while the window is empty.
+  uint32_t min() const {
+    if (this->empty())
+      return 0;
+    return *std::min_element(this->samples_.begin(), this->samples_.begin() + this->count_);
+  }
+
+  uint32_t average() const {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < this->count_; ++i)
+      sum += this->samples_[i];
+    return this->empty() ? 0 : static_cast<uint32_t>(sum / this->count_);
+  }
+
+  // Nearest-rank percentile, `percent` in 1..100.
+  uint32_t percentile(uint8_t percent) const {
+    if (this->empty())
+      return 0;
+    std::array<uint32_t, N> sorted = this->samples_;
+    size_t rank = (static_cast<size_t>(percent) * this->count_ + 99) / 100;
+    size_t index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + this->count_);
+    return sorted[index];
+  }
+
+ protected:
+  // Samples are stored in arrival order modulo N; statistics do not depend on the order.
+  std::array<uint32_t, N> samples_{};
+  size_t next_{0};
+  size_t count_{0};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/components/climate/climate.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+enum class VerticalVanePosition : uint8_t {
+  SWING = 0,
+  UP = 1,
+  UP_MEDIUM = 2,
+  MEDIUM = 3,
+  MEDIUM_DOWN = 4,
+  DOWN = 5,
+  STATIC = 6,
+};
+
+// One entry of a byte <-> enum mapping.
+template<typename T> struct ByteMapping {
+  T value;
+  uint8_t byte;
+};
+
+// Dense lookup tables for both directions, generated from a single list of
+// ByteMapping entries. `B` bounds the wire bytes, `V` the enum values.
+template<typename T, size_t B, size_t V> class ByteMap {
+ public:
+  static constexpr uint8_t UNMAPPED = 0xFF;
+
+  template<size_t N> constexpr explicit ByteMap(const ByteMapping<T> (&entries)[N]) {
+    for (size_t i = 0; i < B; ++i)
+      this->to_value_[i] = UNMAPPED;
+    for (size_t i = 0; i < V; ++i)
+      this->to_byte_[i] = UNMAPPED;
+
+    for (size_t i = 0; i < N; ++i) {
+      size_t value = static_cast<size_t>(entries[i].value);
+      size_t byte = entries[i].byte;
+      if (value >= V || byte >= B || this->to_byte_[value] != UNMAPPED || this->to_value_[byte] != UNMAPPED) {
+        this->consistent_ = false;
+        continue;
+      }
+      this->to_byte_[value] = entries[i].byte;
+      this->to_value_[byte] = static_cast<uint8_t>(value);
+    }
+  }
+
+  // Every byte and every value appears at most once and within bounds, so
+  // decode(encode(v)) == v and encode(decode(b)) == b for all mapped entries.
+  constexpr bool consistent() const { return this->consistent_; }
+
+  constexpr bool decode(uint8_t byte, T *value) const {
+    if (byte >= B || this->to_value_[byte] == UNMAPPED)
+      return false;
+    *value = static_cast<T>(this->to_value_[byte]);
+    return true;
+  }
+
+  constexpr bool encode(T value, uint8_t *byte) const {
+    size_t index = static_cast<size_t>(value);
+    if (index >= V || this->to_byte_[index] == UNMAPPED)
+      return false;
+    *byte = this->to_byte_[index];
+    return true;
+  }
+
+ protected:
+  uint8_t to_value_[B]{};
+  uint8_t to_byte_[V]{};
+  bool consistent_{true};
+};
+
+template<typename T, size_t N> constexpr size_t max_mapped_byte(const ByteMapping<T> (&entries)[N]) {
+  size_t result = 0;
+  for (size_t i = 0; i < N; ++i)
+    result = entries[i].byte > result ? entries[i].byte : result;
+  return result;
+}
+
+template<typename T, size_t N> constexpr size_t max_mapped_value(const ByteMapping<T> (&entries)[N]) {
+  size_t result = 0;
+  for (size_t i = 0; i < N; ++i)
+    result = static_cast<size_t>(entries[i].value) > result ? static_cast<size_t>(entries[i].value) : result;
+  return result;
+}
+
+// Mode byte, valid while the power byte is 0x01. OFF is encoded through the power byte instead.
+static constexpr ByteMapping<climate::ClimateMode> MODE_ENTRIES[] = {
+    {climate::CLIMATE_MODE_AUTO, 0x00}, {climate::CLIMATE_MODE_COOL, 0x01},     {climate::CLIMATE_MODE_DRY, 0x02},
+    {climate::CLIMATE_MODE_HEAT, 0x03}, {climate::CLIMATE_MODE_FAN_ONLY, 0x04},
+};
+
+// Fan speed byte. QUIET is encoded as AUTO plus QUIET_FLAG_MASK in flags1 instead.
+static constexpr ByteMapping<climate::ClimateFanMode> FAN_MODE_ENTRIES[] = {
+    {climate::CLIMATE_FAN_AUTO, 0x00},
+    {climate::CLIMATE_FAN_LOW, 0x01},
+    {climate::CLIMATE_FAN_MEDIUM, 0x02},
+    {climate::CLIMATE_FAN_HIGH, 0x03},
+};
+
+// Vertical vane byte.
+static constexpr ByteMapping<VerticalVanePosition> VERTICAL_VANE_ENTRIES[] = {
+    {VerticalVanePosition::SWING, 0x00},     {VerticalVanePosition::DOWN, 0x01},
+    {VerticalVanePosition::MEDIUM_DOWN, 0x02}, {VerticalVanePosition::MEDIUM, 0x03},
+    {VerticalVanePosition::UP_MEDIUM, 0x04}, {VerticalVanePosition::UP, 0x05},
+    {VerticalVanePosition::STATIC, 0x06},
+};
+
+static constexpr ByteMap<climate::ClimateMode, max_mapped_byte(MODE_ENTRIES) + 1, max_mapped_value(MODE_ENTRIES) + 1>
+    MODE_MAP{MODE_ENTRIES};
+static constexpr ByteMap<climate::ClimateFanMode, max_mapped_byte(FAN_MODE_ENTRIES) + 1,
+                         max_mapped_value(FAN_MODE_ENTRIES) + 1>
+    FAN_MODE_MAP{FAN_MODE_ENTRIES};
+static constexpr ByteMap<VerticalVanePosition, max_mapped_byte(VERTICAL_VANE_ENTRIES) + 1,
+                         max_mapped_value(VERTICAL_VANE_ENTRIES) + 1>
+    VERTICAL_VANE_MAP{VERTICAL_VANE_ENTRIES};
+
+static_assert(MODE_MAP.consistent(), "MODE_ENTRIES must map bytes and modes one-to-one");
+static_assert(FAN_MODE_MAP.consistent(), "FAN_MODE_ENTRIES must map bytes and fan modes one-to-one");
+static_assert(VERTICAL_VANE_MAP.consistent(), "VERTICAL_VANE_ENTRIES must map bytes and positions one-to-one");
+
+}  // namespace daewoo_ac
+}  // namespace esphome
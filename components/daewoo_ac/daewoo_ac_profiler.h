@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Stages of DaewooAC::loop() timed by the profiler.
+enum class LoopStage : uint8_t {
+  UART_DRAIN = 0,
+  PARSE,
+  SYNC,
+  FRAME_BUILD,
+  TX_WRITE,
+  // Time in loop() outside of all other stages
+  OTHER,
+  // Inclusive time of each outermost scope, i.e. of whole loop() calls
+  TOTAL,
+};
+static constexpr size_t LOOP_STAGE_COUNT = 7;
+
+inline const char *loop_stage_name(LoopStage stage) {
+  switch (stage) {
+    case LoopStage::UART_DRAIN:
+      return "UART drain";
+    case LoopStage::PARSE:
+      return "Parse";
+    case LoopStage::SYNC:
+      return "State sync";
+    case LoopStage::FRAME_BUILD:
+      return "Frame build";
+    case LoopStage::TX_WRITE:
+      return "TX write";
+    case LoopStage::OTHER:
+      return "Other";
+    case LoopStage::TOTAL:
+      return "Total";
+  }
+  return "Unknown";
+}
+
+// Running statistics of one stage, in ticks of the profiler clock.
+struct StageStats {
+  uint32_t max{0};
+  uint32_t count{0};
+  uint64_t total{0};
+
+  uint32_t average() const { return this->count == 0 ? 0 : static_cast<uint32_t>(this->total / this->count); }
+};
+
+// Accumulates per-stage timings from a free-running tick counter such as the
+// CPU cycle counter. Stages may nest; each records only its own (exclusive)
+// time, so a parent stage does not double-count the stages it calls. The
+// outermost scope additionally records its inclusive time as TOTAL.
+class LoopProfiler {
+ public:
+  using TickSource = uint32_t (*)();
+
+  // RAII guard timing one stage from construction to destruction.
+  class Scope {
+   public:
+    Scope(LoopProfiler &profiler, LoopStage stage)
+        : profiler_(profiler), stage_(stage), start_(profiler.ticks_()), saved_child_ticks_(profiler.child_ticks_) {
+      profiler.child_ticks_ = 0;
+      ++profiler.depth_;
+    }
+    ~Scope() {
+      uint32_t elapsed = this->profiler_.ticks_() - this->start_;
+      this->profiler_.record(this->stage_, elapsed - this->profiler_.child_ticks_);
+      this->profiler_.child_ticks_ = this->saved_child_ticks_ + elapsed;
+      if (--this->profiler_.depth_ == 0)
+        this->profiler_.record(LoopStage::TOTAL, elapsed);
+    }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   protected:
+    LoopProfiler &profiler_;
+    LoopStage stage_;
+    uint32_t start_;
+    uint32_t saved_child_ticks_;
+  };
+
+  // `ticks_per_us` converts the tick source to microseconds for reporting.
+  LoopProfiler(TickSource ticks, uint32_t ticks_per_us) : ticks_(ticks), ticks_per_us_(ticks_per_us ? ticks_per_us : 1) {}
+
+  void record(LoopStage stage, uint32_t ticks) {
+    StageStats &stats = this->stats_[static_cast<size_t>(stage)];
+    if (ticks > stats.max)
+      stats.max = ticks;
+    stats.total += ticks;
+    ++stats.count;
+  }
+
+  const StageStats &stats(LoopStage stage) const { return this->stats_[static_cast<size_t>(stage)]; }
+  uint32_t to_us(uint32_t ticks) const { return ticks / this->ticks_per_us_; }
+  void reset() {
+    for (auto &stats : this->stats_)
+      stats = StageStats{};
+  }
+
+ protected:
+  TickSource ticks_;
+  uint32_t ticks_per_us_;
+  // Time spent in nested scopes of the innermost open scope
+  uint32_t child_ticks_{0};
+  uint8_t depth_{0};
+  StageStats stats_[LOOP_STAGE_COUNT]{};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
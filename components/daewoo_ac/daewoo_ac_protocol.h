@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Length (in bytes) of Daewoo AC UART messages we care about
+static constexpr size_t MESSAGE_LENGTH = 22;
+// First byte of every Daewoo AC UART message
+static constexpr uint8_t FRAME_HEADER = 0xAA;
+
+// First payload byte: direction of the request
+static constexpr uint8_t OPERATION_READ = 0x01;
+static constexpr uint8_t OPERATION_WRITE = 0x02;
+
+// Payload of a full status/command frame (everything after the 0xAA and length bytes).
+struct DaewooState {
+  uint8_t operation;           // 0x01 for read operation, 0x02 for write operation
+  uint8_t power_state;         // done
+  uint8_t reserved0;
+  uint8_t vertical_vane;       // done
+  uint8_t flags0;
+  uint8_t mode;                // done
+  uint8_t flags1;              // bits 1, 2, 5 - done
+  uint8_t fan_mode;            // done
+  uint8_t target_temperature;  // done
+  uint8_t current_temperature; // done
+  uint8_t reserved1[9];
+  uint8_t checksum;            // done
+};
+
+// DaewooState is copied byte-for-byte to and from the wire; keep it in sync with the protocol.
+static_assert(std::is_trivially_copyable<DaewooState>::value, "DaewooState must be trivially copyable");
+static_assert(sizeof(DaewooState) == MESSAGE_LENGTH - 2, "DaewooState must match the frame payload size");
+static_assert(offsetof(DaewooState, power_state) == 1, "DaewooState::power_state offset");
+static_assert(offsetof(DaewooState, vertical_vane) == 3, "DaewooState::vertical_vane offset");
+static_assert(offsetof(DaewooState, flags0) == 4, "DaewooState::flags0 offset");
+static_assert(offsetof(DaewooState, mode) == 5, "DaewooState::mode offset");
+static_assert(offsetof(DaewooState, flags1) == 6, "DaewooState::flags1 offset");
+static_assert(offsetof(DaewooState, fan_mode) == 7, "DaewooState::fan_mode offset");
+static_assert(offsetof(DaewooState, target_temperature) == 8, "DaewooState::target_temperature offset");
+static_assert(offsetof(DaewooState, current_temperature) == 9, "DaewooState::current_temperature offset");
+static_assert(offsetof(DaewooState, checksum) == MESSAGE_LENGTH - 3, "DaewooState::checksum offset");
+
+// Sum of `len` bytes starting at `offset`, modulo 256. `bytes` is anything indexable
+// with operator[] (std::array, RingBuffer, ...), so the same routine validates
+// received frames and seals constant frames at compile time.
+template<typename Bytes> constexpr uint8_t frame_checksum(const Bytes &bytes, size_t offset, size_t len) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < len; ++i) {
+    sum = static_cast<uint8_t>(sum + bytes[offset + i]);
+  }
+  return sum;
+}
+
+// A complete wire frame: 0xAA, length byte, payload, checksum.
+template<size_t N> struct Frame {
+  static_assert(N >= 3, "A frame needs at least a header, a length byte and a checksum");
+
+  std::array<uint8_t, N> bytes;
+
+  static constexpr size_t size() { return N; }
+  constexpr const uint8_t *data() const { return this->bytes.data(); }
+  constexpr uint8_t operator[](size_t i) const { return this->bytes[i]; }
+
+  // Fill in the header, length and checksum bytes around the payload.
+  constexpr Frame &seal() {
+    this->bytes[0] = FRAME_HEADER;
+    this->bytes[1] = static_cast<uint8_t>(N - 2);
+    this->bytes[N - 1] = frame_checksum(this->bytes, 0, N - 1);
+    return *this;
+  }
+};
+
+// Build a sealed frame around the given payload bytes; usable in constant expressions.
+template<typename... Ts> constexpr Frame<sizeof...(Ts) + 3> make_frame(Ts... payload) {
+  Frame<sizeof...(Ts) + 3> frame{{{0, 0, static_cast<uint8_t>(payload)..., 0}}};
+  frame.seal();
+  return frame;
+}
+
+// Status request sent on every poll tick.
+static constexpr Frame<4> POLL_FRAME = make_frame(OPERATION_READ);
+static_assert(POLL_FRAME[0] == 0xAA && POLL_FRAME[1] == 0x02 && POLL_FRAME[2] == 0x01 && POLL_FRAME[3] == 0xAD,
+              "Poll frame must be AA 02 01 AD");
+
+// Encode a full state frame, forcing the operation byte and computing the checksum.
+inline Frame<MESSAGE_LENGTH> encode_state_frame(DaewooState state, uint8_t operation) {
+  Frame<MESSAGE_LENGTH> frame{};
+  state.operation = operation;
+  state.checksum = 0x00;
+  std::memcpy(frame.bytes.data() + 2U, &state, sizeof(DaewooState));
+  return frame.seal();
+}
+
+// True if the checksum stored in `state` matches its payload, e.g. after loading it from flash.
+inline bool state_checksum_valid(const DaewooState &state) {
+  return encode_state_frame(state, state.operation)[MESSAGE_LENGTH - 1] == state.checksum;
+}
+
+}  // namespace daewoo_ac
+}  // namespace esphome
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Fixed-capacity byte FIFO used to stage UART data without touching the heap.
+// Head and tail are free-running counters; only their difference matters, so
+// wraparound of the counters themselves is harmless.
+template<size_t N> class RingBuffer {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+ public:
+  // Non-owning window of `size()` bytes starting `offset` bytes after the ring head.
+  // Only valid until the ring is modified.
+  class View {
+   public:
+    View(const RingBuffer *ring, size_t offset, size_t size) : ring_(ring), offset_(offset), size_(size) {}
+
+    size_t size() const { return this->size_; }
+    uint8_t operator[](size_t i) const { return (*this->ring_)[this->offset_ + i]; }
+    void copy_to(uint8_t *dst, size_t from, size_t len) const { this->ring_->copy_out(this->offset_ + from, dst, len); }
+
+   protected:
+    const RingBuffer *ring_;
+    size_t offset_;
+    size_t size_;
+  };
+
+  static constexpr size_t capacity() { return N; }
+  size_t size() const { return this->tail_ - this->head_; }
+  size_t available_space() const { return N - this->size(); }
+  bool empty() const { return this->head_ == this->tail_; }
+
+  uint8_t operator[](size_t i) const { return this->data_[(this->head_ + i) & MASK]; }
+  View view(size_t offset, size_t size) const { return View(this, offset, size); }
+
+  // Largest contiguous writable region at the tail. Fill it, then call commit().
+  uint8_t *write_region(size_t *len) {
+    size_t index = this->tail_ & MASK;
+    size_t contiguous = N - index;
+    size_t space = this->available_space();
+    *len = space < contiguous ? space : contiguous;
+    return &this->data_[index];
+  }
+  void commit(size_t len) { this->tail_ += len; }
+
+  void discard(size_t len) { this->head_ += len < this->size() ? len : this->size(); }
+  void clear() { this->head_ = this->tail_; }
+
+  void copy_out(size_t offset, uint8_t *dst, size_t len) const {
+    size_t index = (this->head_ + offset) & MASK;
+    size_t first = N - index < len ? N - index : len;
+    std::memcpy(dst, &this->data_[index], first);
+    std::memcpy(dst + first, &this->data_[0], len - first);
+  }
+
+ protected:
+  static constexpr size_t MASK = N - 1;
+
+  uint8_t data_[N]{};
+  size_t head_{0};
+  size_t tail_{0};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
@@ -7,30 +7,24 @@ namespace daewoo_ac {
 static const char *const TAG = "daewoo_ac.select";
 
 void DaewooACVaneSelect::setup() {
-  // Get initial state from parent, or use first option if not set
-  std::string initial_state;
-  const auto &options = this->traits.get_options();
-
-  if (this->parent_ != nullptr) {
-    this->parent_->set_vertical_vane_labels(options);
-
-    initial_state = this->parent_->get_vertical_vane_display_value();
-    ESP_LOGCONFIG(TAG, "Setting up Vertical Vane Select");
-    
-    // If the initial state is not in the options list, use the first option
-    if (!this->has_option(initial_state) && !options.empty()) {
-      initial_state = options[0];
-      ESP_LOGW(TAG, "Initial state not in options, using first option: %s", initial_state.c_str());
-      
-      // Update parent with the valid initial state
-      this->parent_->set_vertical_vane_position(initial_state);
-    }
-    
-    ESP_LOGCONFIG(TAG, "Initial state: %s", initial_state.c_str());
-    this->publish_state(initial_state);
-  } else {
+  if (this->parent_ == nullptr) {
     ESP_LOGE(TAG, "Parent not set for vane select during setup");
+    return;
   }
+
+  // Options are in VerticalVanePosition order, so the position doubles as the option index.
+  this->parent_->set_vertical_vane_labels(this->traits.get_options());
+
+  ESP_LOGCONFIG(TAG, "Setting up Vertical Vane Select");
+  ESP_LOGCONFIG(TAG, "Initial state: %s", this->parent_->get_vertical_vane_label());
+  this->publish_position_(this->parent_->get_vertical_vane_position_state());
+
+  this->parent_->add_on_vertical_vane_callback(
+      [this](VerticalVanePosition position) { this->publish_position_(position); });
+}
+
+void DaewooACVaneSelect::publish_position_(VerticalVanePosition position) {
+  this->publish_state(static_cast<size_t>(position));
 }
 
 void DaewooACVaneSelect::control(const std::string &value) {
@@ -39,10 +33,22 @@ void DaewooACVaneSelect::control(const std::string &value) {
     return;
   }
 
-  this->parent_->enqueue_ui_change("vertical_vane", value);
-  this->parent_->set_vertical_vane_position(value);
-  
-  this->publish_state(value);
+  auto index = this->index_of(value);
+  if (!index.has_value() || *index >= VERTICAL_VANE_OPTION_COUNT) {
+    ESP_LOGW(TAG, "Unknown vertical vane option '%s'", value.c_str());
+    return;
+  }
+
+  auto position = static_cast<VerticalVanePosition>(*index);
+  this->parent_->request_vertical_vane(position);
+
+  if (this->parent_->get_vertical_vane_position_state() == position) {
+    // The parent will not notify about an unchanged position; acknowledge directly.
+    this->publish_position_(position);
+    return;
+  }
+
+  this->parent_->set_vertical_vane_position(position);
 }
 
 }  // namespace daewoo_ac
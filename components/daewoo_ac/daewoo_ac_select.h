@@ -16,6 +16,7 @@ class DaewooACVaneSelect : public select::Select, public Component {
 
  protected:
   void control(const std::string &value) override;
+  void publish_position_(VerticalVanePosition position);
   
   DaewooAC *parent_{nullptr};
 };
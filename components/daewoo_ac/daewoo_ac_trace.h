@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "daewoo_ac_protocol.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+// Format `len` bytes starting at `offset` as "AA 14 ..." into `out`, which must
+// hold at least 3 * len + 1 characters. Only called where the result is logged.
+template<typename Bytes> void format_frame_hex(const Bytes &bytes, size_t offset, size_t len, char *out) {
+  static const char *const DIGITS = "0123456789ABCDEF";
+  for (size_t i = 0; i < len; ++i) {
+    uint8_t byte = bytes[offset + i];
+    *out++ = DIGITS[byte >> 4];
+    *out++ = DIGITS[byte & 0x0F];
+    *out++ = ' ';
+  }
+  *out = '\0';
+}
+
+enum class TraceDirection : uint8_t {
+  RX = 0,
+  TX = 1,
+};
+
+// Up to one frame's worth of raw bytes as they crossed the wire. RX records hold
+// whatever one UART read returned, including noise and partial frames.
+struct TraceRecord {
+  uint32_t timestamp;
+  TraceDirection direction;
+  uint8_t length;
+  uint8_t bytes[MESSAGE_LENGTH];
+};
+
+// Binary log of the most recent records, sized once at runtime so every unit can
+// pick its own capacity. Recording copies raw bytes only; formatting is left to
+// whoever reads the records back. Until allocate() is called nothing is recorded.
+class FrameTrace {
+ public:
+  void allocate(size_t capacity) {
+    this->records_.reset(capacity > 0 ? new TraceRecord[capacity]() : nullptr);
+    this->capacity_ = capacity;
+    this->clear();
+  }
+
+  template<typename Bytes>
+  void record(uint32_t timestamp, TraceDirection direction, const Bytes &bytes, size_t offset, size_t len) {
+    if (this->capacity_ == 0) {
+      return;
+    }
+    TraceRecord &entry = this->records_[this->next_];
+    entry.timestamp = timestamp;
+    entry.direction = direction;
+    entry.length = static_cast<uint8_t>(len < MESSAGE_LENGTH ? len : MESSAGE_LENGTH);
+    for (size_t i = 0; i < entry.length; ++i) {
+      entry.bytes[i] = bytes[offset + i];
+    }
+    this->next_ = (this->next_ + 1) % this->capacity_;
+    if (this->count_ < this->capacity_) {
+      ++this->count_;
+    }
+  }
+
+  // Record `len` raw bytes, split into as many records as needed.
+  void record_bytes(uint32_t timestamp, TraceDirection direction, const uint8_t *data, size_t len) {
+    for (size_t offset = 0; offset < len; offset += MESSAGE_LENGTH) {
+      this->record(timestamp, direction, data, offset, len - offset);
+    }
+  }
+
+  size_t size() const { return this->count_; }
+  size_t capacity() const { return this->capacity_; }
+  void clear() {
+    this->next_ = 0;
+    this->count_ = 0;
+  }
+
+  // i = 0 is the oldest record still held.
+  const TraceRecord &operator[](size_t i) const {
+    return this->records_[(this->next_ + this->capacity_ - this->count_ + i) % this->capacity_];
+  }
+
+ protected:
+  std::unique_ptr<TraceRecord[]> records_;
+  size_t capacity_{0};
+  size_t next_{0};
+  size_t count_{0};
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
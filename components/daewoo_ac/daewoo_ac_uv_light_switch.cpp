@@ -12,8 +12,15 @@ void DaewooACUVLightSwitch::setup() {
     return;
   }
 
-  ESP_LOGCONFIG(TAG, "Setting up UV Light Toggle");
-  this->publish_state(this->parent_->is_uv_light_on());
+  bool initial_state = this->parent_->is_uv_light_on();
+
+  ESP_LOGCONFIG(TAG, "Setting up UV Light Toggle (initial state: %s)", initial_state ? "ON" : "OFF");
+  this->publish_state(initial_state);
+
+  this->parent_->add_on_uv_light_callback([this](bool on) {
+    ESP_LOGD(TAG, "UV light state updated: %s", on ? "ON" : "OFF");
+    this->publish_state(on);
+  });
 }
 
 void DaewooACUVLightSwitch::write_state(bool state) {
@@ -22,13 +29,18 @@ void DaewooACUVLightSwitch::write_state(bool state) {
     return;
   }
 
-  this->parent_->enqueue_ui_change("uv_light_on", state ? "true" : "false");
+  this->parent_->request_uv_light(state);
+
+  if (this->parent_->is_uv_light_on() == state) {
+    // The parent will not notify about an unchanged value; acknowledge directly.
+    ESP_LOGD(TAG, "UV light already %s", state ? "ON" : "OFF");
+    this->publish_state(state);
+    return;
+  }
+
   this->parent_->set_uv_light_on(state);
-  this->publish_state(state);
 }
 
 }  // namespace daewoo_ac
 }  // namespace esphome
 
-
-
@@ -56,5 +56,4 @@ async def to_code(config):
         await cg.register_component(var, vane_config)
         cg.add(var.set_parent(parent))
         cg.add(var.set_vane_type(True))  # True for vertical
-        cg.add(parent.set_vertical_vane_select(var))
 
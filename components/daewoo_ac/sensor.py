@@ -0,0 +1,87 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MILLISECOND,
+    UNIT_SECOND,
+)
+from . import DaewooAC, daewoo_ac_ns
+
+CONF_DAEWOO_AC_ID = "daewoo_ac_id"
+CONF_FRAMES_SENT = "frames_sent"
+CONF_FRAMES_RECEIVED = "frames_received"
+CONF_CHECKSUM_ERRORS = "checksum_errors"
+CONF_LENGTH_ERRORS = "length_errors"
+CONF_RESYNCS = "resyncs"
+CONF_BYTES_DISCARDED = "bytes_discarded"
+CONF_FAILED_COMMITS = "failed_commits"
+CONF_POLL_RTT_MIN = "poll_rtt_min"
+CONF_POLL_RTT_AVG = "poll_rtt_avg"
+CONF_POLL_RTT_P95 = "poll_rtt_p95"
+CONF_LAST_FRAME_AGE = "last_frame_age"
+CONF_POLL_INTERVAL = "poll_interval"
+
+DaewooACLinkSensor = daewoo_ac_ns.class_("DaewooACLinkSensor", cg.PollingComponent)
+
+COUNTERS = [
+    CONF_FRAMES_SENT,
+    CONF_FRAMES_RECEIVED,
+    CONF_CHECKSUM_ERRORS,
+    CONF_LENGTH_ERRORS,
+    CONF_RESYNCS,
+    CONF_BYTES_DISCARDED,
+    CONF_FAILED_COMMITS,
+]
+LATENCIES = [CONF_POLL_RTT_MIN, CONF_POLL_RTT_AVG, CONF_POLL_RTT_P95, CONF_POLL_INTERVAL]
+
+
+def counter_schema():
+    return sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+def latency_schema():
+    return sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+CONFIG_SCHEMA = (
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(DaewooACLinkSensor),
+            cv.GenerateID(CONF_DAEWOO_AC_ID): cv.use_id(DaewooAC),
+            **{cv.Optional(key): counter_schema() for key in COUNTERS},
+            **{cv.Optional(key): latency_schema() for key in LATENCIES},
+            cv.Optional(CONF_LAST_FRAME_AGE): sensor.sensor_schema(
+                unit_of_measurement=UNIT_SECOND,
+                accuracy_decimals=1,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+        }
+    )
+    .extend(cv.polling_component_schema("60s"))
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_DAEWOO_AC_ID])
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_parent(parent))
+
+    for key in COUNTERS + LATENCIES + [CONF_LAST_FRAME_AGE]:
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(getattr(var, f"set_{key}_sensor")(sens))
@@ -37,7 +37,6 @@ async def to_code(config):
     display_switch = await switch.new_switch(display_config)
     await cg.register_component(display_switch, display_config)
     cg.add(display_switch.set_parent(parent))
-    cg.add(parent.set_display_switch(display_switch))
 
     uv_config = config.get(CONF_UV_LIGHT)
     if uv_config is not None:
@@ -48,7 +47,6 @@ async def to_code(config):
         uv_switch = await switch.new_switch(uv_config)
         await cg.register_component(uv_switch, uv_config)
         cg.add(uv_switch.set_parent(parent))
-        cg.add(parent.set_uv_light_switch(uv_switch))
 
     horizontal_swing_config = config.get(CONF_HORIZONTAL_SWING)
     if horizontal_swing_config is not None:
@@ -0,0 +1,201 @@
+// Microbenchmarks for the hot paths of DaewooAC::loop(). Every benchmark reports
+// heap allocations per iteration next to the time, e.g.:
+//
+//   ./build/daewoo_ac_benchmark --benchmark_filter=Loop
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <new>
+
+#include "daewoo_ac/daewoo_ac.h"
+#include "daewoo_ac_test_access.h"
+#include "frames.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+size_t allocations = 0;
+bool count_allocations = true;
+
+// Reports the allocations made while it is alive as "allocs/op".
+class AllocationCounter {
+ public:
+  explicit AllocationCounter(benchmark::State &state) : state_(state), start_(allocations) {}
+  ~AllocationCounter() {
+    this->state_.counters["allocs/op"] =
+        benchmark::Counter(static_cast<double>(allocations - this->start_), benchmark::Counter::kAvgIterations);
+  }
+
+ protected:
+  benchmark::State &state_;
+  size_t start_;
+};
+
+// Keeps harness work such as injecting RX bytes out of the allocation count.
+class UncountedScope {
+ public:
+  UncountedScope() { count_allocations = false; }
+  ~UncountedScope() { count_allocations = true; }
+};
+
+using Buffer = FrameParser::Buffer;
+
+void fill(Buffer &buffer, const std::vector<uint8_t> &bytes) {
+  size_t space;
+  uint8_t *dst = buffer.write_region(&space);
+  std::memcpy(dst, bytes.data(), bytes.size());
+  buffer.commit(bytes.size());
+}
+
+// A unit that has answered once and has nothing to do.
+struct Unit {
+  uart::UARTComponent uart;
+  DaewooAC ac;
+
+  Unit() {
+    global_preferences->reset();
+    testing::set_millis(1000);
+    this->ac.set_uart(&this->uart);
+    this->ac.setup();
+    this->uart.inject_rx(testing::status_frame(testing::idle_state()));
+    for (int i = 0; i < 10; ++i) {
+      testing::advance_millis(10);
+      this->ac.loop();
+    }
+    this->uart.clear_tx();
+  }
+};
+
+void BM_ParseUartResponse(benchmark::State &state) {
+  Unit unit;
+  Buffer buffer;
+  fill(buffer, testing::status_frame(testing::idle_state()));
+  auto view = buffer.view(0, MESSAGE_LENGTH);
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    DaewooACTestAccess::parse_uart_response(unit.ac, view);
+  }
+}
+BENCHMARK(BM_ParseUartResponse);
+
+// Every frame reports a different room temperature, so each one is decoded and published.
+void BM_ParseUartResponseChanged(benchmark::State &state) {
+  Unit unit;
+  DaewooState warm = testing::idle_state();
+  warm.current_temperature = 23;
+  Buffer buffers[2];
+  fill(buffers[0], testing::status_frame(testing::idle_state()));
+  fill(buffers[1], testing::status_frame(warm));
+  auto views = {buffers[0].view(0, MESSAGE_LENGTH), buffers[1].view(0, MESSAGE_LENGTH)};
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    for (const auto &view : views)
+      DaewooACTestAccess::parse_uart_response(unit.ac, view);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_ParseUartResponseChanged);
+
+void BM_SyncDaewooState(benchmark::State &state) {
+  Unit unit;
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    DaewooACTestAccess::sync_daewoo_state(unit.ac, FIELDS_ALL);
+  }
+}
+BENCHMARK(BM_SyncDaewooState);
+
+void BM_SyncDaewooStateChanged(benchmark::State &state) {
+  Unit unit;
+  DaewooState &raw = DaewooACTestAccess::daewoo_state(unit.ac);
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    raw.target_temperature = raw.target_temperature == 24 ? 25 : 24;
+    DaewooACTestAccess::sync_daewoo_state(unit.ac, FIELDS_ALL);
+  }
+}
+BENCHMARK(BM_SyncDaewooStateChanged);
+
+// Queue state.range(0) UI changes, then build the single command frame that carries them.
+void BM_BuildCommandFrame(benchmark::State &state) {
+  Unit unit;
+  const int changes = static_cast<int>(state.range(0));
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    for (int i = 0; i < changes; ++i) {
+      switch (i % 4) {
+        case 0:
+          unit.ac.request_target_temperature(18.0f + i % 10);
+          break;
+        case 1:
+          unit.ac.request_fan_mode(i % 8 < 4 ? climate::CLIMATE_FAN_LOW : climate::CLIMATE_FAN_HIGH);
+          break;
+        case 2:
+          unit.ac.request_mode(climate::CLIMATE_MODE_COOL);
+          break;
+        default:
+          unit.ac.request_display(i % 8 < 4);
+          break;
+      }
+    }
+    auto frame = DaewooACTestAccess::build_command_frame(unit.ac);
+    benchmark::DoNotOptimize(frame);
+    DaewooACTestAccess::forget_command(unit.ac);
+  }
+}
+BENCHMARK(BM_BuildCommandFrame)->Arg(1)->Arg(10)->Arg(50);
+
+// Nothing received, nothing due: the cost every idle loop() pays.
+void BM_LoopIdle(benchmark::State &state) {
+  Unit unit;
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    unit.ac.loop();
+  }
+}
+BENCHMARK(BM_LoopIdle);
+
+// One complete status frame waiting in the UART per loop().
+void BM_LoopWithRx(benchmark::State &state) {
+  Unit unit;
+  const auto frame = testing::status_frame(testing::idle_state());
+  AllocationCounter counter(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      UncountedScope uncounted;
+      unit.uart.inject_rx(frame);
+    }
+    state.ResumeTiming();
+    unit.ac.loop();
+  }
+}
+BENCHMARK(BM_LoopWithRx);
+
+}  // namespace
+
+// Scalar and array forms both count. The actual malloc()/free() calls sit in helpers that
+// are never inlined into a new/delete call site, so GCC does not pair the replaced
+// operator new with free() and report -Wmismatched-new-delete.
+namespace {
+__attribute__((noinline)) void *counted_malloc(size_t size) {
+  if (count_allocations)
+    ++allocations;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+__attribute__((noinline)) void counted_free(void *ptr) noexcept { std::free(ptr); }
+}  // namespace
+
+void *operator new(size_t size) { return counted_malloc(size); }
+void *operator new[](size_t size) { return counted_malloc(size); }
+void operator delete(void *ptr) noexcept { counted_free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { counted_free(ptr); }
+void operator delete[](void *ptr) noexcept { counted_free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { counted_free(ptr); }
+
+BENCHMARK_MAIN();
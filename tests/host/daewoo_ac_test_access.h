@@ -0,0 +1,31 @@
+#pragma once
+
+// Reaches the private steps of DaewooAC::loop() so tests and benchmarks can run them in isolation.
+
+#include "daewoo_ac/daewoo_ac.h"
+
+namespace esphome {
+namespace daewoo_ac {
+
+class DaewooACTestAccess {
+ public:
+  static void parse_uart_response(DaewooAC &ac, const FrameParser::View &frame) { ac.parse_uart_response_(frame); }
+  static void sync_daewoo_state(DaewooAC &ac, uint8_t fields) { ac.sync_daewoo_state(fields); }
+  static Frame<MESSAGE_LENGTH> build_command_frame(DaewooAC &ac) { return ac.build_command_frame_from_state_(); }
+
+  static DaewooState &daewoo_state(DaewooAC &ac) { return ac.daewoo_state_; }
+  static uint8_t dirty_fields(const DaewooAC &ac) { return ac.dirty_fields_; }
+  static uint8_t unconfirmed_fields(const DaewooAC &ac) { return ac.unconfirmed_fields_; }
+#ifdef USE_DAEWOO_AC_TRACE
+  static const FrameTrace &trace(const DaewooAC &ac) { return ac.trace_; }
+#endif
+  // Drop any command in flight, as if the AC had confirmed it.
+  static void forget_command(DaewooAC &ac) {
+    ac.dirty_fields_ = 0;
+    ac.unconfirmed_fields_ = 0;
+    ac.send_immediately_ = false;
+  }
+};
+
+}  // namespace daewoo_ac
+}  // namespace esphome
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <set>
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace climate {
+
+enum ClimateMode : uint8_t {
+  CLIMATE_MODE_OFF = 0,
+  CLIMATE_MODE_HEAT_COOL = 1,
+  CLIMATE_MODE_COOL = 2,
+  CLIMATE_MODE_HEAT = 3,
+  CLIMATE_MODE_FAN_ONLY = 4,
+  CLIMATE_MODE_DRY = 5,
+  CLIMATE_MODE_AUTO = 6,
+};
+
+enum ClimateFanMode : uint8_t {
+  CLIMATE_FAN_ON = 0,
+  CLIMATE_FAN_OFF = 1,
+  CLIMATE_FAN_AUTO = 2,
+  CLIMATE_FAN_LOW = 3,
+  CLIMATE_FAN_MEDIUM = 4,
+  CLIMATE_FAN_HIGH = 5,
+  CLIMATE_FAN_MIDDLE = 6,
+  CLIMATE_FAN_FOCUS = 7,
+  CLIMATE_FAN_DIFFUSE = 8,
+  CLIMATE_FAN_QUIET = 9,
+};
+
+enum ClimateSwingMode : uint8_t {
+  CLIMATE_SWING_OFF = 0,
+  CLIMATE_SWING_BOTH = 1,
+  CLIMATE_SWING_VERTICAL = 2,
+  CLIMATE_SWING_HORIZONTAL = 3,
+};
+
+enum class ClimateFeature : uint32_t {
+  CLIMATE_SUPPORTS_CURRENT_TEMPERATURE = 1 << 0,
+};
+
+class ClimateTraits {
+ public:
+  void set_supported_modes(std::initializer_list<ClimateMode> modes) { this->modes_ = modes; }
+  void set_supported_fan_modes(std::initializer_list<ClimateFanMode> modes) { this->fan_modes_ = modes; }
+  void set_supported_swing_modes(std::initializer_list<ClimateSwingMode> modes) { this->swing_modes_ = modes; }
+  void add_feature_flags(ClimateFeature flag) { this->features_ |= static_cast<uint32_t>(flag); }
+  void set_visual_min_temperature(float value) { this->min_temperature_ = value; }
+  void set_visual_max_temperature(float value) { this->max_temperature_ = value; }
+  void set_visual_temperature_step(float value) { this->temperature_step_ = value; }
+
+  bool supports_mode(ClimateMode mode) const { return this->modes_.count(mode) != 0; }
+  bool supports_fan_mode(ClimateFanMode mode) const { return this->fan_modes_.count(mode) != 0; }
+  bool supports_swing_mode(ClimateSwingMode mode) const { return this->swing_modes_.count(mode) != 0; }
+
+ protected:
+  std::set<ClimateMode> modes_;
+  std::set<ClimateFanMode> fan_modes_;
+  std::set<ClimateSwingMode> swing_modes_;
+  uint32_t features_{0};
+  float min_temperature_{10.0f};
+  float max_temperature_{30.0f};
+  float temperature_step_{0.1f};
+};
+
+class Climate;
+
+class ClimateCall {
+ public:
+  explicit ClimateCall(Climate *parent) : parent_(parent) {}
+
+  ClimateCall &set_mode(ClimateMode mode) {
+    this->mode_ = mode;
+    return *this;
+  }
+  ClimateCall &set_target_temperature(float target_temperature) {
+    this->target_temperature_ = target_temperature;
+    return *this;
+  }
+  ClimateCall &set_fan_mode(ClimateFanMode fan_mode) {
+    this->fan_mode_ = fan_mode;
+    return *this;
+  }
+  ClimateCall &set_swing_mode(ClimateSwingMode swing_mode) {
+    this->swing_mode_ = swing_mode;
+    return *this;
+  }
+  void perform();
+
+  const optional<ClimateMode> &get_mode() const { return this->mode_; }
+  const optional<float> &get_target_temperature() const { return this->target_temperature_; }
+  const optional<ClimateFanMode> &get_fan_mode() const { return this->fan_mode_; }
+  const optional<ClimateSwingMode> &get_swing_mode() const { return this->swing_mode_; }
+
+ protected:
+  Climate *parent_;
+  optional<ClimateMode> mode_;
+  optional<float> target_temperature_;
+  optional<ClimateFanMode> fan_mode_;
+  optional<ClimateSwingMode> swing_mode_;
+};
+
+class Climate : public EntityBase {
+ public:
+  virtual ~Climate() = default;
+
+  ClimateCall make_call() { return ClimateCall(this); }
+  void publish_state();
+  void add_on_state_callback(std::function<void(Climate &)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+  ClimateMode mode{CLIMATE_MODE_OFF};
+  optional<ClimateFanMode> fan_mode;
+  ClimateSwingMode swing_mode{CLIMATE_SWING_OFF};
+  float current_temperature{0.0f};
+  float target_temperature{0.0f};
+
+ protected:
+  friend ClimateCall;
+
+  virtual void control(const ClimateCall &call) = 0;
+  virtual ClimateTraits traits() = 0;
+
+  CallbackManager<void(Climate &)> state_callback_;
+};
+
+}  // namespace climate
+}  // namespace esphome
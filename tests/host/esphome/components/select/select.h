@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace select {
+
+class SelectTraits {
+ public:
+  void set_options(const FixedVector<const char *> &options) { this->options_ = options; }
+  const FixedVector<const char *> &get_options() const { return this->options_; }
+
+ protected:
+  FixedVector<const char *> options_;
+};
+
+class Select : public EntityBase {
+ public:
+  virtual ~Select() = default;
+
+  SelectTraits traits;
+  std::string state;
+
+  void publish_state(const std::string &state);
+  void publish_state(size_t index);
+  optional<size_t> index_of(const std::string &option) const;
+  optional<std::string> at(size_t index) const;
+  size_t size() const { return this->traits.get_options().size(); }
+  bool has_option(const std::string &option) const { return this->index_of(option).has_value(); }
+  optional<size_t> active_index() const { return this->index_of(this->state); }
+
+  // Host stand-in for make_call().set_option(option).perform().
+  void set_option(const std::string &option) { this->control(option); }
+
+ protected:
+  virtual void control(const std::string &value) = 0;
+};
+
+}  // namespace select
+}  // namespace esphome
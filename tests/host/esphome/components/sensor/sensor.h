@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cmath>
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+
+namespace esphome {
+namespace sensor {
+
+class Sensor : public EntityBase {
+ public:
+  float state{NAN};
+
+  void publish_state(float state) { this->state = state; }
+  float get_state() const { return this->state; }
+};
+
+}  // namespace sensor
+}  // namespace esphome
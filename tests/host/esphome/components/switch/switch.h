@@ -0,0 +1,24 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+
+namespace esphome {
+namespace switch_ {
+
+class Switch : public EntityBase {
+ public:
+  virtual ~Switch() = default;
+
+  bool state{false};
+
+  void publish_state(bool state) { this->state = state; }
+  void turn_on() { this->write_state(true); }
+  void turn_off() { this->write_state(false); }
+
+ protected:
+  virtual void write_state(bool state) = 0;
+};
+
+}  // namespace switch_
+}  // namespace esphome
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace uart {
+
+enum UARTParityOptions {
+  UART_CONFIG_PARITY_NONE,
+  UART_CONFIG_PARITY_EVEN,
+  UART_CONFIG_PARITY_ODD,
+};
+
+// Host stand-in for a UART. Tests push bytes the component will read with
+// inject_rx() and inspect what it wrote with tx(), or route every write to a
+// handler such as a simulated indoor unit.
+class UARTComponent {
+ public:
+  int available() const { return static_cast<int>(this->rx_.size()); }
+  bool read_byte(uint8_t *data) { return this->read_array(data, 1); }
+  bool read_array(uint8_t *data, size_t len);
+  void write_array(const uint8_t *data, size_t len);
+  void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
+  void flush() {}
+
+  uint32_t get_baud_rate() const { return this->baud_rate_; }
+  uint8_t get_data_bits() const { return this->data_bits_; }
+  uint8_t get_stop_bits() const { return this->stop_bits_; }
+  UARTParityOptions get_parity() const { return this->parity_; }
+  void set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
+  void set_data_bits(uint8_t data_bits) { this->data_bits_ = data_bits; }
+  void set_stop_bits(uint8_t stop_bits) { this->stop_bits_ = stop_bits; }
+  void set_parity(UARTParityOptions parity) { this->parity_ = parity; }
+
+  // Host only.
+  void inject_rx(const uint8_t *data, size_t len) { this->rx_.insert(this->rx_.end(), data, data + len); }
+  void inject_rx(const std::vector<uint8_t> &data) { this->inject_rx(data.data(), data.size()); }
+  size_t rx_pending() const { return this->rx_.size(); }
+  // Bytes written since the last clear_tx(), unless a write handler takes them.
+  const std::vector<uint8_t> &tx() const { return this->tx_; }
+  void clear_tx() { this->tx_.clear(); }
+  // Number of write_array() calls, i.e. frames for this component.
+  size_t get_write_count() const { return this->writes_; }
+  void set_write_handler(std::function<void(const uint8_t *, size_t)> &&handler) {
+    this->write_handler_ = std::move(handler);
+  }
+
+ protected:
+  std::deque<uint8_t> rx_;
+  std::vector<uint8_t> tx_;
+  size_t writes_{0};
+  std::function<void(const uint8_t *, size_t)> write_handler_;
+  uint32_t baud_rate_{9600};
+  uint8_t data_bits_{8};
+  uint8_t stop_bits_{1};
+  UARTParityOptions parity_{UART_CONFIG_PARITY_NONE};
+};
+
+}  // namespace uart
+}  // namespace esphome
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+// A constant or a lambda of the trigger arguments.
+template<typename T, typename... X> class TemplatableValue {
+ public:
+  TemplatableValue() = default;
+  TemplatableValue(T value) : value_(value), has_value_(true) {}
+  template<typename F, typename std::enable_if<std::is_invocable_r<T, F, X...>::value, int>::type = 0>
+  TemplatableValue(F f) : f_(std::move(f)), has_value_(true) {}
+
+  bool has_value() const { return this->has_value_; }
+  T value(X... x) const { return this->f_ ? this->f_(x...) : this->value_; }
+
+ protected:
+  T value_{};
+  std::function<T(X...)> f_;
+  bool has_value_{false};
+};
+
+#define TEMPLATABLE_VALUE_(type, name) \
+ protected: \
+  TemplatableValue<type, Ts...> name##_{}; \
+\
+ public: \
+  template<typename V> void set_##name(V name) { this->name##_ = name; }
+
+#define TEMPLATABLE_VALUE(type, name) TEMPLATABLE_VALUE_(type, name)
+
+template<typename... Ts> class Action {
+ public:
+  virtual ~Action() = default;
+  void play_complex(Ts... x) { this->play(x...); }
+
+ protected:
+  virtual void play(Ts... x) = 0;
+};
+
+template<typename T> class Parented {
+ public:
+  Parented() = default;
+  explicit Parented(T *parent) : parent_(parent) {}
+  void set_parent(T *parent) { this->parent_ = parent; }
+
+ protected:
+  T *parent_{nullptr};
+};
+
+}  // namespace esphome
@@ -0,0 +1,3 @@
+#pragma once
+
+// Feature flags come from the CMake target (USE_HOST, USE_DAEWOO_AC_TRACE, ...).
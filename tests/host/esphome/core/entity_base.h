@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+class EntityBase {
+ public:
+  void set_name(const char *name) { this->name_ = name; }
+  const char *get_name() const { return this->name_.c_str(); }
+  uint32_t get_object_id_hash() const { return fnv1_hash(this->name_); }
+
+ protected:
+  std::string name_{"host"};
+};
+
+}  // namespace esphome
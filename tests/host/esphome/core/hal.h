@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+// Host build: the clock only moves when a test advances it.
+uint32_t millis();
+uint32_t micros();
+uint32_t arch_get_cpu_cycle_count();
+uint32_t arch_get_cpu_freq_hz();
+
+namespace testing {
+
+// Set or advance the clock returned by millis(). micros() and the cycle counter follow it.
+void set_millis(uint32_t now);
+void advance_millis(uint32_t ms);
+
+}  // namespace testing
+}  // namespace esphome
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+
+template<typename T> using optional = std::optional<T>;
+using std::nullopt;
+
+template<typename T> T clamp(T value, T min, T max) { return value < min ? min : (value > max ? max : value); }
+
+uint32_t fnv1_hash(const std::string &str);
+
+// Vector whose size is fixed after init(); backed by std::vector on the host.
+template<typename T> class FixedVector {
+ public:
+  FixedVector() = default;
+  FixedVector(std::initializer_list<T> values) : data_(values) {}
+
+  void init(size_t n) {
+    this->data_.clear();
+    this->data_.reserve(n);
+  }
+  void push_back(const T &value) { this->data_.push_back(value); }
+  size_t size() const { return this->data_.size(); }
+  bool empty() const { return this->data_.empty(); }
+  const T &operator[](size_t i) const { return this->data_[i]; }
+  T &operator[](size_t i) { return this->data_[i]; }
+  typename std::vector<T>::const_iterator begin() const { return this->data_.begin(); }
+  typename std::vector<T>::const_iterator end() const { return this->data_.end(); }
+
+ protected:
+  std::vector<T> data_;
+};
+
+template<typename... X> class CallbackManager;
+
+template<typename... Ts> class CallbackManager<void(Ts...)> {
+ public:
+  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void call(Ts... args) {
+    for (auto &callback : this->callbacks_)
+      callback(args...);
+  }
+  size_t size() const { return this->callbacks_.size(); }
+
+ protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+
+}  // namespace esphome
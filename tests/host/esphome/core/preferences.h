@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome {
+
+// Handle to one stored value. The host build keeps it in RAM for as long as the
+// ESPPreferences instance lives, so a test can "reboot" by creating a new component.
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  ESPPreferenceObject(std::vector<uint8_t> *slot, size_t length, uint32_t *saves, uint32_t *failed_saves,
+                      const bool *fail_saves)
+      : slot_(slot), length_(length), saves_(saves), failed_saves_(failed_saves), fail_saves_(fail_saves) {}
+
+  template<typename T> bool save(const T *src) {
+    if (this->slot_ == nullptr || sizeof(T) != this->length_)
+      return false;
+    if (*this->fail_saves_) {
+      ++*this->failed_saves_;
+      return false;
+    }
+    this->slot_->assign(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<const uint8_t *>(src) + sizeof(T));
+    ++*this->saves_;
+    return true;
+  }
+
+  template<typename T> bool load(T *dest) {
+    if (this->slot_ == nullptr || this->slot_->size() != sizeof(T))
+      return false;
+    std::memcpy(dest, this->slot_->data(), sizeof(T));
+    return true;
+  }
+
+ protected:
+  std::vector<uint8_t> *slot_{nullptr};
+  size_t length_{0};
+  uint32_t *saves_{nullptr};
+  uint32_t *failed_saves_{nullptr};
+  const bool *fail_saves_{nullptr};
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash = false) {
+    return this->make_preference(sizeof(T), type, in_flash);
+  }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool /*in_flash*/ = false) {
+    return ESPPreferenceObject(&this->slots_[type], length, &this->saves_, &this->failed_saves_, &this->fail_saves_);
+  }
+  bool sync() { return true; }
+
+  // Host only: number of successful and failed saves, making every save fail as with
+  // a full or broken flash, and wiping everything as after a flash erase.
+  uint32_t get_save_count() const { return this->saves_; }
+  uint32_t get_failed_save_count() const { return this->failed_saves_; }
+  void set_fail_saves(bool fail) { this->fail_saves_ = fail; }
+  void reset() {
+    this->slots_.clear();
+    this->saves_ = 0;
+    this->failed_saves_ = 0;
+    this->fail_saves_ = false;
+  }
+
+ protected:
+  std::map<uint32_t, std::vector<uint8_t>> slots_;
+  uint32_t saves_{0};
+  uint32_t failed_saves_{0};
+  bool fail_saves_{false};
+};
+
+extern ESPPreferences *global_preferences;
+
+}  // namespace esphome
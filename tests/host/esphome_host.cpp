@@ -0,0 +1,117 @@
+// Implementations behind the host stand-ins for the ESPHome core and components.
+
+#include <cstdarg>
+#include <cstdio>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+#include "esphome/components/climate/climate.h"
+#include "esphome/components/select/select.h"
+#include "esphome/components/uart/uart.h"
+
+namespace esphome {
+
+namespace {
+uint32_t now_ms = 0;
+int log_level = ESPHOME_LOG_LEVEL_WARN;
+}  // namespace
+
+uint32_t millis() { return now_ms; }
+uint32_t micros() { return now_ms * 1000U; }
+uint32_t arch_get_cpu_cycle_count() { return now_ms * 240000U; }
+uint32_t arch_get_cpu_freq_hz() { return 240000000U; }
+
+uint32_t fnv1_hash(const std::string &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= static_cast<uint8_t>(c);
+  }
+  return hash;
+}
+
+static ESPPreferences host_preferences;
+ESPPreferences *global_preferences = &host_preferences;
+
+namespace testing {
+
+void set_millis(uint32_t now) { now_ms = now; }
+void advance_millis(uint32_t ms) { now_ms += ms; }
+
+void set_log_level(int level) { log_level = level; }
+
+void log_printf(int level, const char *tag, int line, const char *format, ...) {
+  // Format even when filtered out so benchmarks pay for the logging that is compiled in.
+  char message[256];
+  va_list args;
+  va_start(args, format);
+  std::vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+  if (level <= log_level) {
+    std::fprintf(stderr, "[%10u][%s:%d]: %s\n", now_ms, tag, line, message);
+  }
+}
+
+}  // namespace testing
+
+namespace climate {
+
+void ClimateCall::perform() { this->parent_->control(*this); }
+
+void Climate::publish_state() { this->state_callback_.call(*this); }
+
+}  // namespace climate
+
+namespace select {
+
+void Select::publish_state(const std::string &state) { this->state = state; }
+
+void Select::publish_state(size_t index) {
+  auto option = this->at(index);
+  if (option.has_value())
+    this->state = *option;
+}
+
+optional<size_t> Select::index_of(const std::string &option) const {
+  const auto &options = this->traits.get_options();
+  for (size_t i = 0; i < options.size(); ++i) {
+    if (option == options[i])
+      return i;
+  }
+  return nullopt;
+}
+
+optional<std::string> Select::at(size_t index) const {
+  const auto &options = this->traits.get_options();
+  if (index >= options.size())
+    return nullopt;
+  return std::string(options[index]);
+}
+
+}  // namespace select
+
+namespace uart {
+
+bool UARTComponent::read_array(uint8_t *data, size_t len) {
+  if (this->rx_.size() < len)
+    return false;
+  for (size_t i = 0; i < len; ++i) {
+    data[i] = this->rx_.front();
+    this->rx_.pop_front();
+  }
+  return true;
+}
+
+void UARTComponent::write_array(const uint8_t *data, size_t len) {
+  ++this->writes_;
+  if (this->write_handler_) {
+    this->write_handler_(data, len);
+    return;
+  }
+  this->tx_.insert(this->tx_.end(), data, data + len);
+}
+
+}  // namespace uart
+}  // namespace esphome
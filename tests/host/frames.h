@@ -0,0 +1,32 @@
+#pragma once
+
+// Building blocks for feeding the component well-formed status frames.
+
+#include <vector>
+
+#include "daewoo_ac/daewoo_ac_protocol.h"
+
+namespace esphome {
+namespace testing {
+
+// A unit that is switched off: 24 °C target, 22 °C room, display on.
+inline daewoo_ac::DaewooState idle_state() {
+  daewoo_ac::DaewooState state{};
+  state.operation = daewoo_ac::OPERATION_READ;
+  state.power_state = 0x00;
+  state.vertical_vane = 0x06;
+  state.mode = 0x01;
+  state.flags1 = 0x10;
+  state.fan_mode = 0x00;
+  state.target_temperature = 24;
+  state.current_temperature = 22;
+  return state;
+}
+
+inline std::vector<uint8_t> status_frame(const daewoo_ac::DaewooState &state) {
+  auto frame = daewoo_ac::encode_state_frame(state, daewoo_ac::OPERATION_READ);
+  return std::vector<uint8_t>(frame.bytes.begin(), frame.bytes.end());
+}
+
+}  // namespace testing
+}  // namespace esphome
@@ -0,0 +1,36 @@
+#include "testing.h"
+
+namespace esphome {
+namespace testing {
+
+namespace {
+int failures = 0;
+}  // namespace
+
+std::vector<TestCase> &registry() {
+  static std::vector<TestCase> tests;
+  return tests;
+}
+
+void fail(const char *file, int line, const char *expression) {
+  std::printf("  %s:%d: expected %s\n", file, line, expression);
+  ++failures;
+}
+
+}  // namespace testing
+}  // namespace esphome
+
+int main() {
+  using namespace esphome::testing;
+  int failed_tests = 0;
+  for (const TestCase &test : registry()) {
+    int before = failures;
+    test.run();
+    bool passed = failures == before;
+    std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.name);
+    if (!passed)
+      ++failed_tests;
+  }
+  std::printf("%zu tests, %d failed\n", registry().size(), failed_tests);
+  return failed_tests == 0 ? 0 : 1;
+}
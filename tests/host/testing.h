@@ -0,0 +1,42 @@
+#pragma once
+
+// Minimal test registry for the host tests; each test executable links test_main.cpp.
+
+#include <cstdio>
+#include <vector>
+
+namespace esphome {
+namespace testing {
+
+struct TestCase {
+  const char *name;
+  void (*run)();
+};
+
+std::vector<TestCase> &registry();
+// Mark the running test as failed after printing where.
+void fail(const char *file, int line, const char *expression);
+
+struct TestRegistrar {
+  TestRegistrar(const char *name, void (*run)()) { registry().push_back({name, run}); }
+};
+
+}  // namespace testing
+}  // namespace esphome
+
+#define TEST(name) \
+  static void test_##name(); \
+  static ::esphome::testing::TestRegistrar registrar_##name(#name, &test_##name); \
+  static void test_##name()
+
+#define EXPECT_TRUE(expr) \
+  do { \
+    if (!(expr)) \
+      ::esphome::testing::fail(__FILE__, __LINE__, #expr); \
+  } while (0)
+
+#define EXPECT_FALSE(expr) EXPECT_TRUE(!(expr))
+#define EXPECT_EQ(a, b) EXPECT_TRUE((a) == (b))
+#define EXPECT_NE(a, b) EXPECT_TRUE((a) != (b))
+#define EXPECT_LE(a, b) EXPECT_TRUE((a) <= (b))
+#define EXPECT_GE(a, b) EXPECT_TRUE((a) >= (b))
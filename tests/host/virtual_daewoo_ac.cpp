@@ -0,0 +1,119 @@
+#include "virtual_daewoo_ac.h"
+
+#include "frames.h"
+
+namespace esphome {
+namespace testing {
+
+using namespace daewoo_ac;
+
+VirtualDaewooAC::VirtualDaewooAC(uint32_t seed) : state_(idle_state()), rng_(seed != 0 ? seed : 1) {}
+
+void VirtualDaewooAC::attach(uart::UARTComponent *uart) {
+  this->uart_ = uart;
+  uart->set_write_handler([this](const uint8_t *data, size_t len) { this->on_write_(data, len); });
+}
+
+uint32_t VirtualDaewooAC::random_() {
+  // xorshift32: deterministic for a given seed, so every scenario replays exactly.
+  uint32_t x = this->rng_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  this->rng_ = x;
+  return x;
+}
+
+void VirtualDaewooAC::on_write_(const uint8_t *data, size_t len) {
+  this->rx_.insert(this->rx_.end(), data, data + len);
+
+  // The component writes whole frames; split them by their length byte.
+  while (!this->rx_.empty()) {
+    if (this->rx_[0] != FRAME_HEADER) {
+      ++this->stats_.bad_frames;
+      this->rx_.erase(this->rx_.begin());
+      continue;
+    }
+    if (this->rx_.size() < 2 || this->rx_.size() < this->rx_[1] + 2U) {
+      return;
+    }
+    size_t frame_len = this->rx_[1] + 2U;
+    std::vector<uint8_t> frame(this->rx_.begin(), this->rx_.begin() + frame_len);
+    this->rx_.erase(this->rx_.begin(), this->rx_.begin() + frame_len);
+    if (frame_checksum(frame, 0, frame_len - 1) != frame[frame_len - 1]) {
+      ++this->stats_.bad_frames;
+      continue;
+    }
+    this->handle_frame_(frame);
+  }
+}
+
+void VirtualDaewooAC::handle_frame_(const std::vector<uint8_t> &frame) {
+  if (frame.size() == POLL_FRAME.size() && frame[2] == OPERATION_READ) {
+    ++this->stats_.polls;
+    this->queue_status_();
+    return;
+  }
+  if (frame.size() == MESSAGE_LENGTH && frame[2] == OPERATION_WRITE) {
+    ++this->stats_.writes;
+    DaewooState command;
+    std::memcpy(&command, frame.data() + 2, sizeof(DaewooState));
+    // The unit takes over the settable bytes; the room temperature is its own.
+    this->state_.power_state = command.power_state;
+    this->state_.vertical_vane = command.vertical_vane;
+    this->state_.flags0 = command.flags0;
+    this->state_.mode = command.mode;
+    this->state_.flags1 = command.flags1;
+    this->state_.fan_mode = command.fan_mode;
+    this->state_.target_temperature = command.target_temperature;
+    return;
+  }
+  ++this->stats_.bad_frames;
+}
+
+void VirtualDaewooAC::queue_status_() {
+  if (this->chance_(this->faults_.drop_reply_percent)) {
+    ++this->stats_.dropped_replies;
+    return;
+  }
+
+  Reply reply;
+  reply.due = this->now_ + this->faults_.response_delay_ms;
+  if (this->faults_.response_jitter_ms > 0) {
+    reply.due += this->random_() % (this->faults_.response_jitter_ms + 1);
+  }
+
+  bool damaged = false;
+  if (this->chance_(this->faults_.noise_percent)) {
+    uint32_t count = 1 + this->random_() % (this->faults_.max_noise_bytes > 0 ? this->faults_.max_noise_bytes : 1);
+    for (uint32_t i = 0; i < count; ++i)
+      reply.bytes.push_back(static_cast<uint8_t>(this->random_()));
+    damaged = true;
+  }
+  std::vector<uint8_t> frame = status_frame(this->state_);
+  if (this->chance_(this->faults_.drop_byte_percent)) {
+    frame.erase(frame.begin() + this->random_() % frame.size());
+    damaged = true;
+  }
+  if (this->chance_(this->faults_.corrupt_byte_percent)) {
+    frame[this->random_() % frame.size()] ^= static_cast<uint8_t>(1 + this->random_() % 255);
+    damaged = true;
+  }
+  reply.bytes.insert(reply.bytes.end(), frame.begin(), frame.end());
+  if (damaged)
+    ++this->stats_.damaged_replies;
+  this->replies_.push_back(std::move(reply));
+}
+
+void VirtualDaewooAC::tick(uint32_t now) {
+  this->now_ = now;
+  while (!this->replies_.empty() && static_cast<int32_t>(now - this->replies_.front().due) >= 0) {
+    ++this->stats_.replies;
+    if (this->uart_ != nullptr)
+      this->uart_->inject_rx(this->replies_.front().bytes);
+    this->replies_.pop_front();
+  }
+}
+
+}  // namespace testing
+}  // namespace esphome
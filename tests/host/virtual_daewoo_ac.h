@@ -0,0 +1,83 @@
+#pragma once
+
+// In-process stand-in for a Daewoo indoor unit on the other end of the fake UART.
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "daewoo_ac/daewoo_ac_protocol.h"
+#include "esphome/components/uart/uart.h"
+
+namespace esphome {
+namespace testing {
+
+// Faults applied to the unit's replies. Probabilities are per reply, in percent.
+struct LinkFaults {
+  // Extra delay before a reply starts, fixed plus a uniformly random part
+  uint32_t response_delay_ms{20};
+  uint32_t response_jitter_ms{0};
+  uint8_t drop_reply_percent{0};
+  uint8_t drop_byte_percent{0};
+  uint8_t corrupt_byte_percent{0};
+  // Random bytes put on the line in front of a reply
+  uint8_t noise_percent{0};
+  uint8_t max_noise_bytes{8};
+};
+
+struct VirtualUnitStats {
+  uint32_t polls{0};
+  uint32_t writes{0};
+  uint32_t bad_frames{0};
+  uint32_t replies{0};
+  uint32_t dropped_replies{0};
+  uint32_t damaged_replies{0};
+};
+
+// Answers AA 02 01 AD polls with a status frame and applies 0x02 write frames to
+// its state, like the real unit. Call tick() with the current time before every
+// loop() of the component to put due replies on the line.
+class VirtualDaewooAC {
+ public:
+  explicit VirtualDaewooAC(uint32_t seed = 1);
+
+  // Take every byte the component writes to `uart`, and reply into it.
+  void attach(uart::UARTComponent *uart);
+  void tick(uint32_t now);
+
+  void set_faults(const LinkFaults &faults) { this->faults_ = faults; }
+  const LinkFaults &get_faults() const { return this->faults_; }
+  const VirtualUnitStats &get_stats() const { return this->stats_; }
+
+  const daewoo_ac::DaewooState &state() const { return this->state_; }
+  // Change the unit behind the component's back, as the IR remote does.
+  daewoo_ac::DaewooState &ir_remote() { return this->state_; }
+  void set_room_temperature(uint8_t celsius) { this->state_.current_temperature = celsius; }
+
+  // Replies waiting for their delay to pass.
+  size_t pending_replies() const { return this->replies_.size(); }
+
+ protected:
+  struct Reply {
+    uint32_t due;
+    std::vector<uint8_t> bytes;
+  };
+
+  void on_write_(const uint8_t *data, size_t len);
+  void handle_frame_(const std::vector<uint8_t> &frame);
+  void queue_status_();
+  uint32_t random_();
+  bool chance_(uint8_t percent) { return percent > 0 && this->random_() % 100 < percent; }
+
+  uart::UARTComponent *uart_{nullptr};
+  daewoo_ac::DaewooState state_{};
+  LinkFaults faults_{};
+  VirtualUnitStats stats_{};
+  std::vector<uint8_t> rx_;
+  std::deque<Reply> replies_;
+  uint32_t now_{0};
+  uint32_t rng_;
+};
+
+}  // namespace testing
+}  // namespace esphome
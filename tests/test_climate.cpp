@@ -0,0 +1,182 @@
+#include <vector>
+
+#include "daewoo_ac/daewoo_ac.h"
+#include "frames.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+struct Fixture {
+  uart::UARTComponent uart;
+  DaewooAC ac;
+
+  Fixture() {
+    global_preferences->reset();
+    testing::set_millis(1000);
+    this->ac.set_uart(&this->uart);
+    this->ac.setup();
+  }
+
+  // Run loop() every `step` ms for `duration` ms.
+  void run(uint32_t duration, uint32_t step = 5) {
+    for (uint32_t t = 0; t < duration; t += step) {
+      testing::advance_millis(step);
+      this->ac.loop();
+    }
+  }
+};
+
+const std::vector<uint8_t> POLL(POLL_FRAME.bytes.begin(), POLL_FRAME.bytes.end());
+
+}  // namespace
+
+TEST(polls_at_boot) {
+  Fixture f;
+  f.ac.loop();
+  EXPECT_TRUE(f.uart.tx() == POLL);
+}
+
+TEST(decodes_status_frame) {
+  Fixture f;
+  DaewooState state = testing::idle_state();
+  state.power_state = 0x01;
+  state.mode = 0x03;
+  state.fan_mode = 0x02;
+  state.target_temperature = 21;
+  state.current_temperature = 19;
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  EXPECT_EQ(f.ac.mode, climate::CLIMATE_MODE_HEAT);
+  EXPECT_TRUE(f.ac.fan_mode == climate::CLIMATE_FAN_MEDIUM);
+  EXPECT_EQ(f.ac.target_temperature, 21.0f);
+  EXPECT_EQ(f.ac.current_temperature, 19.0f);
+  EXPECT_TRUE(f.ac.has_received_frame());
+}
+
+TEST(control_sends_one_command_frame) {
+  Fixture f;
+  f.uart.inject_rx(testing::status_frame(testing::idle_state()));
+  f.run(20);
+  f.uart.clear_tx();
+
+  f.ac.make_call().set_mode(climate::CLIMATE_MODE_COOL).set_target_temperature(20.0f).perform();
+  f.run(COMMAND_DEBOUNCE_DEFAULT_MILLIS + 10);
+
+  const auto &tx = f.uart.tx();
+  EXPECT_EQ(tx.size(), MESSAGE_LENGTH);
+  if (tx.size() == MESSAGE_LENGTH) {
+    EXPECT_EQ(tx[2], OPERATION_WRITE);
+    EXPECT_EQ(tx[3], 0x01);   // power on
+    EXPECT_EQ(tx[7], 0x01);   // cool
+    EXPECT_EQ(tx[10], 20);    // target temperature
+    EXPECT_EQ(tx[MESSAGE_LENGTH - 1], frame_checksum(tx, 0, MESSAGE_LENGTH - 1));
+  }
+}
+
+TEST(command_confirmed_by_status) {
+  Fixture f;
+  f.uart.inject_rx(testing::status_frame(testing::idle_state()));
+  f.run(20);
+  f.ac.make_call().set_target_temperature(26.0f).perform();
+  f.run(COMMAND_DEBOUNCE_DEFAULT_MILLIS + 10);
+
+  DaewooState confirmed = testing::idle_state();
+  confirmed.target_temperature = 26;
+  f.uart.inject_rx(testing::status_frame(confirmed));
+  f.run(20);
+  EXPECT_EQ(f.ac.get_failed_commit_count(), 0U);
+  EXPECT_EQ(f.ac.target_temperature, 26.0f);
+  // No retransmission once confirmed.
+  f.uart.clear_tx();
+  f.run(COMMAND_ACK_TIMEOUT_MILLIS * 2);
+  EXPECT_EQ(f.uart.tx().size() % POLL_FRAME.size(), 0U);
+}
+
+TEST(state_saved_only_when_a_setting_changes) {
+  Fixture f;
+  DaewooState state = testing::idle_state();
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  EXPECT_EQ(global_preferences->get_save_count(), 1U);
+
+  // Room temperature drift alone never reaches flash.
+  for (uint8_t room = 18; room < 28; ++room) {
+    state.current_temperature = room;
+    f.uart.inject_rx(testing::status_frame(state));
+    f.run(20);
+  }
+  EXPECT_EQ(global_preferences->get_save_count(), 1U);
+
+  // A changed setting is saved right away, so a reboot shortly after restores it.
+  state.target_temperature = 19;
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  EXPECT_EQ(global_preferences->get_save_count(), 2U);
+}
+
+TEST(restored_state_published_once_at_boot) {
+  {
+    Fixture f;
+    DaewooState state = testing::idle_state();
+    state.power_state = 0x01;
+    state.mode = 0x03;
+    state.target_temperature = 27;
+    f.uart.inject_rx(testing::status_frame(state));
+    f.run(20);
+  }
+
+  // Reboot without wiping preferences.
+  uart::UARTComponent uart;
+  DaewooAC ac;
+  ac.set_uart(&uart);
+  int publishes = 0;
+  ac.add_on_state_callback([&](climate::Climate &) { ++publishes; });
+  ac.setup();
+  EXPECT_EQ(publishes, 1);
+  EXPECT_EQ(ac.mode, climate::CLIMATE_MODE_HEAT);
+  EXPECT_EQ(ac.target_temperature, 27.0f);
+}
+
+TEST(failed_save_retried_after_the_next_setting_change) {
+  Fixture f;
+  global_preferences->set_fail_saves(true);
+  DaewooState state = testing::idle_state();
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(1000);
+  EXPECT_EQ(global_preferences->get_failed_save_count(), 1U);
+
+  state.target_temperature = 20;
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(1000);
+  EXPECT_EQ(global_preferences->get_failed_save_count(), 2U);
+
+  global_preferences->set_fail_saves(false);
+  state.target_temperature = 21;
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  EXPECT_EQ(global_preferences->get_save_count(), 1U);
+}
+
+TEST(adaptive_polling_ignores_room_temperature_drift) {
+  Fixture f;
+  f.ac.set_adaptive_polling(1000, 8000);
+  DaewooState state = testing::idle_state();
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  for (uint8_t room = 23; room < 27; ++room) {
+    state.current_temperature = room;
+    f.uart.inject_rx(testing::status_frame(state));
+    f.run(20);
+  }
+  EXPECT_EQ(f.ac.current_temperature, 26.0f);
+  EXPECT_EQ(f.ac.get_poll_interval(), 8000U);
+
+  // A changed setting still brings polling back to the fastest rate.
+  state.target_temperature = 20;
+  f.uart.inject_rx(testing::status_frame(state));
+  f.run(20);
+  EXPECT_EQ(f.ac.get_poll_interval(), 1000U);
+}
@@ -0,0 +1,80 @@
+#include <vector>
+
+#include "daewoo_ac/daewoo_ac_frame_parser.h"
+#include "frames.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+// Push `bytes` through the parser the way DaewooAC::loop() does; returns the frames accepted.
+size_t feed(FrameParser &parser, const std::vector<uint8_t> &bytes, uint32_t now) {
+  size_t frames = 0;
+  size_t offset = 0;
+  while (offset < bytes.size()) {
+    size_t space;
+    uint8_t *dst = parser.write_region(&space);
+    if (space == 0) {
+      parser.process([&](const FrameParser::View &) { ++frames; });
+      continue;
+    }
+    size_t chunk = std::min(space, bytes.size() - offset);
+    std::memcpy(dst, bytes.data() + offset, chunk);
+    parser.commit(chunk, now);
+    offset += chunk;
+  }
+  parser.process([&](const FrameParser::View &) { ++frames; });
+  return frames;
+}
+
+}  // namespace
+
+TEST(accepts_single_frame) {
+  FrameParser parser;
+  EXPECT_EQ(feed(parser, testing::status_frame(testing::idle_state()), 0), 1U);
+  EXPECT_EQ(parser.stats().frames, 1U);
+  EXPECT_EQ(parser.pending(), 0U);
+}
+
+TEST(reassembles_split_frame) {
+  FrameParser parser;
+  auto frame = testing::status_frame(testing::idle_state());
+  std::vector<uint8_t> head(frame.begin(), frame.begin() + 7);
+  std::vector<uint8_t> tail(frame.begin() + 7, frame.end());
+  EXPECT_EQ(feed(parser, head, 0), 0U);
+  EXPECT_EQ(parser.pending(), head.size());
+  EXPECT_EQ(feed(parser, tail, 5), 1U);
+}
+
+TEST(resyncs_after_noise) {
+  FrameParser parser;
+  std::vector<uint8_t> bytes = {0x00, 0x13, 0xAA, 0x55};
+  auto frame = testing::status_frame(testing::idle_state());
+  bytes.insert(bytes.end(), frame.begin(), frame.end());
+  EXPECT_EQ(feed(parser, bytes, 0), 1U);
+  EXPECT_EQ(parser.stats().resyncs, 1U);
+  EXPECT_EQ(parser.stats().bytes_discarded, 4U);
+  EXPECT_EQ(parser.stats().length_errors, 1U);
+}
+
+TEST(rejects_bad_checksum) {
+  FrameParser parser;
+  auto bad = testing::status_frame(testing::idle_state());
+  bad[MESSAGE_LENGTH - 1] ^= 0xFF;
+  auto good = testing::status_frame(testing::idle_state());
+  bad.insert(bad.end(), good.begin(), good.end());
+  EXPECT_EQ(feed(parser, bad, 0), 1U);
+  EXPECT_GE(parser.stats().checksum_errors, 1U);
+}
+
+TEST(expires_partial_frame) {
+  FrameParser parser;
+  auto frame = testing::status_frame(testing::idle_state());
+  feed(parser, std::vector<uint8_t>(frame.begin(), frame.begin() + 10), 100);
+  EXPECT_EQ(parser.expire(100 + RX_FRAME_TIMEOUT_MILLIS), 0U);
+  EXPECT_EQ(parser.expire(101 + RX_FRAME_TIMEOUT_MILLIS), 10U);
+  EXPECT_EQ(parser.stats().timeouts, 1U);
+  EXPECT_EQ(parser.pending(), 0U);
+}
@@ -0,0 +1,55 @@
+#include "daewoo_ac/daewoo_ac_mapping.h"
+#include "daewoo_ac/daewoo_ac_protocol.h"
+#include "frames.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+TEST(poll_frame_bytes) {
+  EXPECT_EQ(POLL_FRAME.size(), 4U);
+  EXPECT_EQ(POLL_FRAME[0], 0xAA);
+  EXPECT_EQ(POLL_FRAME[1], 0x02);
+  EXPECT_EQ(POLL_FRAME[2], 0x01);
+  EXPECT_EQ(POLL_FRAME[3], 0xAD);
+}
+
+TEST(encode_state_frame_seals_frame) {
+  DaewooState state = testing::idle_state();
+  auto frame = encode_state_frame(state, OPERATION_WRITE);
+  EXPECT_EQ(frame[0], FRAME_HEADER);
+  EXPECT_EQ(frame[1], MESSAGE_LENGTH - 2);
+  EXPECT_EQ(frame[2], OPERATION_WRITE);
+  EXPECT_EQ(frame[MESSAGE_LENGTH - 1], frame_checksum(frame.bytes, 0, MESSAGE_LENGTH - 1));
+}
+
+TEST(state_checksum_roundtrip) {
+  auto frame = encode_state_frame(testing::idle_state(), OPERATION_READ);
+  DaewooState decoded;
+  std::memcpy(&decoded, frame.data() + 2, sizeof(DaewooState));
+  EXPECT_TRUE(state_checksum_valid(decoded));
+  decoded.target_temperature ^= 0x01;
+  EXPECT_FALSE(state_checksum_valid(decoded));
+}
+
+TEST(mode_map_roundtrip) {
+  EXPECT_TRUE(MODE_MAP.consistent());
+  for (auto mode : {climate::CLIMATE_MODE_AUTO, climate::CLIMATE_MODE_COOL, climate::CLIMATE_MODE_DRY,
+                    climate::CLIMATE_MODE_HEAT, climate::CLIMATE_MODE_FAN_ONLY}) {
+    uint8_t byte = 0xFF;
+    climate::ClimateMode decoded = climate::CLIMATE_MODE_OFF;
+    EXPECT_TRUE(MODE_MAP.encode(mode, &byte));
+    EXPECT_TRUE(MODE_MAP.decode(byte, &decoded));
+    EXPECT_EQ(decoded, mode);
+  }
+  uint8_t byte;
+  EXPECT_FALSE(MODE_MAP.encode(climate::CLIMATE_MODE_HEAT_COOL, &byte));
+}
+
+TEST(fan_and_vane_maps_consistent) {
+  EXPECT_TRUE(FAN_MODE_MAP.consistent());
+  EXPECT_TRUE(VERTICAL_VANE_MAP.consistent());
+  VerticalVanePosition position;
+  EXPECT_TRUE(VERTICAL_VANE_MAP.decode(0x01, &position));
+  EXPECT_TRUE(position == VerticalVanePosition::DOWN);
+}
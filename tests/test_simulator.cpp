@@ -0,0 +1,268 @@
+// End-to-end scenarios against the simulated indoor unit. Each scenario prints
+// what it measured, so regressions in latency or frame counts show up in the log.
+
+#include <cstdio>
+
+#include "daewoo_ac/daewoo_ac.h"
+#include "daewoo_ac/daewoo_ac_bus.h"
+#include "daewoo_ac/daewoo_ac_link_sensor.h"
+#include "daewoo_ac_test_access.h"
+#include "testing.h"
+#include "virtual_daewoo_ac.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+struct Link {
+  uart::UARTComponent uart;
+  testing::VirtualDaewooAC unit;
+  DaewooAC ac;
+
+  explicit Link(size_t trace_records = 0) {
+    global_preferences->reset();
+    testing::set_millis(1000);
+    this->unit.attach(&this->uart);
+    this->ac.set_uart(&this->uart);
+    this->ac.set_trace_buffer_size(trace_records);
+    this->ac.setup();
+    this->run(1000);
+  }
+
+  void step(uint32_t ms) {
+    testing::advance_millis(ms);
+    this->unit.tick(millis());
+    this->ac.loop();
+  }
+  void run(uint32_t duration, uint32_t step = 2) {
+    for (uint32_t t = 0; t < duration; t += step)
+      this->step(step);
+  }
+  // Run until `done()` holds or `timeout` ms passed; returns the time it took.
+  template<typename Predicate> uint32_t run_until(Predicate done, uint32_t timeout, uint32_t step = 2) {
+    uint32_t start = millis();
+    while (!done() && millis() - start < timeout)
+      this->step(step);
+    return millis() - start;
+  }
+  bool confirmed() const {
+    return !this->ac.has_pending_changes() && DaewooACTestAccess::unconfirmed_fields(this->ac) == 0;
+  }
+};
+
+}  // namespace
+
+TEST(boot_poll_is_answered) {
+  Link link;
+  EXPECT_TRUE(link.ac.has_received_frame());
+  EXPECT_GE(link.unit.get_stats().polls, 1U);
+  EXPECT_EQ(link.ac.target_temperature, 24.0f);
+  EXPECT_EQ(link.ac.current_temperature, 22.0f);
+}
+
+TEST(command_to_confirmation) {
+  Link link;
+  uint32_t writes_before = link.unit.get_stats().writes;
+  size_t frames_before = link.uart.get_write_count();
+
+  link.ac.make_call().set_mode(climate::CLIMATE_MODE_HEAT).set_target_temperature(21.0f).perform();
+  uint32_t took = link.run_until([&] { return link.confirmed(); }, 5000);
+
+  std::printf("  command confirmed after %u ms (%u ms reported), %zu frames on the wire\n", took,
+              link.ac.get_last_confirm_latency_ms(), link.uart.get_write_count() - frames_before);
+  EXPECT_TRUE(link.confirmed());
+  EXPECT_EQ(link.unit.get_stats().writes - writes_before, 1U);
+  EXPECT_EQ(link.unit.state().power_state, 0x01);
+  EXPECT_EQ(link.unit.state().mode, 0x03);
+  EXPECT_EQ(link.unit.state().target_temperature, 21);
+  EXPECT_LE(link.ac.get_last_confirm_latency_ms(), COMMAND_CONFIRM_POLL_DELAY_MILLIS + 100);
+}
+
+TEST(scene_costs_one_frame) {
+  Link link;
+  uint32_t writes_before = link.unit.get_stats().writes;
+  StateChange change;
+  change.mode = climate::CLIMATE_MODE_COOL;
+  change.target_temperature = 19.0f;
+  change.fan_mode = climate::CLIMATE_FAN_HIGH;
+  change.vertical_vane = VerticalVanePosition::DOWN;
+  change.display = false;
+  link.ac.apply_state(change);
+  link.run_until([&] { return link.confirmed(); }, 5000);
+
+  EXPECT_EQ(link.unit.get_stats().writes - writes_before, 1U);
+  EXPECT_EQ(link.unit.state().fan_mode, 0x03);
+  EXPECT_EQ(link.unit.state().vertical_vane, 0x01);
+  EXPECT_EQ(link.unit.state().flags1 & DISPLAY_FLAG_MASK, 0);
+}
+
+TEST(ir_remote_change_is_picked_up) {
+  Link link;
+  link.unit.ir_remote().target_temperature = 28;
+  link.unit.ir_remote().power_state = 0x01;
+  uint32_t took = link.run_until([&] { return link.ac.target_temperature == 28.0f; }, 3 * UPDATE_INTERVAL_DEFAULT_MILLIS);
+  std::printf("  IR change visible after %u ms\n", took);
+  EXPECT_EQ(link.ac.target_temperature, 28.0f);
+  EXPECT_LE(took, UPDATE_INTERVAL_DEFAULT_MILLIS + 100);
+}
+
+TEST(recovers_from_line_noise) {
+  Link link;
+  testing::LinkFaults noisy;
+  noisy.noise_percent = 100;
+  noisy.corrupt_byte_percent = 50;
+  noisy.drop_byte_percent = 50;
+  link.unit.set_faults(noisy);
+  link.run(20000);
+
+  link.unit.set_faults(testing::LinkFaults{});
+  uint32_t frames_before = link.ac.get_rx_stats().frames;
+  uint32_t took = link.run_until([&] { return link.ac.get_rx_stats().frames > frames_before; }, 10000);
+  const FrameParserStats &stats = link.ac.get_rx_stats();
+  std::printf("  clean frame %u ms after the noise stopped; %u resyncs, %u checksum, %u length errors, %u timeouts\n",
+              took, stats.resyncs, stats.checksum_errors, stats.length_errors, stats.timeouts);
+  EXPECT_GE(stats.resyncs, 1U);
+  EXPECT_LE(took, UPDATE_INTERVAL_DEFAULT_MILLIS + 100);
+}
+
+TEST(retransmits_while_replies_are_lost) {
+  Link link;
+  testing::LinkFaults deaf;
+  deaf.drop_reply_percent = 100;
+  link.unit.set_faults(deaf);
+  link.ac.make_call().set_target_temperature(30.0f).perform();
+  link.run(2500);
+  link.unit.set_faults(testing::LinkFaults{});
+  uint32_t took = link.run_until([&] { return link.confirmed(); }, 20000);
+
+  std::printf("  confirmed %u ms after replies resumed; %u write frames sent\n", took, link.unit.get_stats().writes);
+  EXPECT_TRUE(link.confirmed());
+  EXPECT_GE(link.unit.get_stats().writes, 2U);
+  EXPECT_EQ(link.ac.get_failed_commit_count(), 0U);
+  EXPECT_EQ(link.ac.target_temperature, 30.0f);
+}
+
+TEST(dropped_command_shows_in_failed_commits_sensor) {
+  Link link;
+  sensor::Sensor failed_commits;
+  DaewooACLinkSensor link_sensor;
+  link_sensor.set_parent(&link.ac);
+  link_sensor.set_failed_commits_sensor(&failed_commits);
+  link_sensor.setup();
+  link_sensor.update();
+  EXPECT_EQ(failed_commits.state, 0.0f);
+
+  testing::LinkFaults deaf;
+  deaf.drop_reply_percent = 100;
+  link.unit.set_faults(deaf);
+  link.ac.make_call().set_target_temperature(30.0f).perform();
+  link.run_until([&] { return link.ac.get_failed_commit_count() > 0; }, 30000);
+  link_sensor.update();
+  EXPECT_EQ(failed_commits.state, 1.0f);
+}
+
+TEST(delayed_replies) {
+  Link link;
+  testing::LinkFaults slow;
+  slow.response_delay_ms = 150;
+  slow.response_jitter_ms = 100;
+  link.unit.set_faults(slow);
+  // Long enough to push every fast sample from before out of the RTT window.
+  link.run((RTT_SAMPLE_COUNT + 2) * UPDATE_INTERVAL_DEFAULT_MILLIS);
+  const auto &rtt = link.ac.get_poll_rtt();
+  std::printf("  poll RTT min %u / avg %u / p95 %u ms\n", rtt.min(), rtt.average(), rtt.percentile(95));
+  EXPECT_GE(rtt.min(), 150U);
+  EXPECT_LE(rtt.percentile(95), 260U);
+}
+
+TEST(trace_replays_line_noise) {
+  Link link(512);
+  testing::LinkFaults noisy;
+  noisy.noise_percent = 100;
+  noisy.corrupt_byte_percent = 5;
+  noisy.drop_byte_percent = 5;
+  link.unit.set_faults(noisy);
+  link.run(20000);
+
+  const auto &trace = DaewooACTestAccess::trace(link.ac);
+  EXPECT_LE(trace.size(), trace.capacity() - 1);
+
+  // Feed only the RX records to a second component on the same loop() cadence: it must see
+  // exactly what the first one saw, noise and all.
+  uart::UARTComponent uart;
+  uart.set_write_handler([](const uint8_t *, size_t) {});
+  DaewooAC replayed;
+  replayed.set_uart(&uart);
+  testing::set_millis(1000);
+  replayed.setup();
+  for (size_t i = 0; i < trace.size();) {
+    uint32_t timestamp = trace[i].timestamp;
+    while (millis() + 2 != timestamp) {
+      testing::advance_millis(2);
+      replayed.loop();
+    }
+    testing::advance_millis(2);
+    // Everything one loop() read, possibly split over several records.
+    for (; i < trace.size() && trace[i].timestamp == timestamp; ++i) {
+      if (trace[i].direction == TraceDirection::RX)
+        uart.inject_rx(trace[i].bytes, trace[i].length);
+    }
+    replayed.loop();
+  }
+
+  const FrameParserStats &live = link.ac.get_rx_stats();
+  const FrameParserStats &again = replayed.get_rx_stats();
+  std::printf("  %zu records; live %u frames / %u resyncs, replayed %u frames / %u resyncs\n", trace.size(),
+              live.frames, live.resyncs, again.frames, again.resyncs);
+  EXPECT_GE(live.resyncs, 1U);
+  // The buffer is per unit: the replaying component never asked for one.
+  EXPECT_EQ(DaewooACTestAccess::trace(replayed).capacity(), 0U);
+  EXPECT_EQ(again.frames, live.frames);
+  EXPECT_EQ(again.checksum_errors, live.checksum_errors);
+  EXPECT_EQ(again.length_errors, live.length_errors);
+  EXPECT_EQ(again.resyncs, live.resyncs);
+  EXPECT_EQ(again.bytes_discarded, live.bytes_discarded);
+}
+
+TEST(adaptive_polling_stays_staggered_on_a_bus) {
+  global_preferences->reset();
+  testing::set_millis(1000);
+  uart::UARTComponent uarts[2];
+  testing::VirtualDaewooAC units[2] = {testing::VirtualDaewooAC(3), testing::VirtualDaewooAC(5)};
+  DaewooAC acs[2];
+  DaewooACBus bus;
+  for (int i = 0; i < 2; ++i) {
+    units[i].attach(&uarts[i]);
+    acs[i].set_uart(&uarts[i]);
+    acs[i].set_adaptive_polling(1000, 8000);
+    bus.add_unit(&acs[i]);
+  }
+  for (DaewooAC &ac : acs)
+    ac.setup();
+  bus.setup();
+
+  // Let both back off to the longest interval, then note when each unit is polled.
+  uint32_t last_polls[2] = {0, 0};
+  uint32_t poll_at[2] = {0, 0};
+  for (uint32_t t = 0; t < 60000; t += 2) {
+    testing::advance_millis(2);
+    for (int i = 0; i < 2; ++i) {
+      units[i].tick(millis());
+      acs[i].loop();
+      if (units[i].get_stats().polls != last_polls[i]) {
+        last_polls[i] = units[i].get_stats().polls;
+        poll_at[i] = millis();
+      }
+    }
+    bus.loop();
+  }
+
+  uint32_t gap = (poll_at[1] - poll_at[0] + 8000) % 8000;
+  std::printf("  intervals %u / %u ms, unit 1 polls %u ms after unit 0\n", acs[0].get_poll_interval(),
+              acs[1].get_poll_interval(), gap);
+  EXPECT_EQ(acs[0].get_poll_interval(), 8000U);
+  EXPECT_EQ(acs[1].get_poll_interval(), 8000U);
+  EXPECT_GE(gap, 3500U);
+  EXPECT_LE(gap, 4500U);
+}
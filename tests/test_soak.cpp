@@ -0,0 +1,179 @@
+// Weeks of simulated operation on a virtual clock: two units on a bus, regular
+// polling, hourly control bursts, IR-remote changes and a noisy line, crossing
+// the 32-bit millis() wraparound on the way.
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "daewoo_ac/daewoo_ac.h"
+#include "daewoo_ac/daewoo_ac_bus.h"
+#include "esphome/core/log.h"
+#include "testing.h"
+#include "virtual_daewoo_ac.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+// Live heap blocks, maintained by the operator new/delete replacements below.
+long live_allocations = 0;
+
+constexpr uint32_t STEP_MILLIS = 20;
+constexpr uint32_t HOUR_MILLIS = 60UL * 60UL * 1000UL;
+constexpr uint32_t DAY_MILLIS = 24UL * HOUR_MILLIS;
+constexpr uint32_t SOAK_DAYS = 21;
+// Start three days before millis() wraps around.
+constexpr uint32_t START_MILLIS = static_cast<uint32_t>(0) - 3 * DAY_MILLIS;
+// Longest acceptable silence between two polls of one unit
+constexpr uint32_t MAX_POLL_GAP_MILLIS = 2 * UPDATE_INTERVAL_DEFAULT_MILLIS + 500;
+// Bytes that may wait in the fake UART: one reply with its leading noise
+constexpr size_t MAX_RX_BACKLOG = MESSAGE_LENGTH + 8;
+
+struct SoakUnit {
+  uart::UARTComponent uart;
+  testing::VirtualDaewooAC sim;
+  DaewooAC ac;
+  uint32_t last_polls{0};
+  uint32_t last_poll_at{0};
+  uint32_t max_poll_gap{0};
+
+  explicit SoakUnit(uint32_t seed) : sim(seed) {}
+
+  void track_polls(uint32_t now) {
+    uint32_t polls = this->sim.get_stats().polls;
+    if (polls != this->last_polls) {
+      if (this->last_polls != 0 && now - this->last_poll_at > this->max_poll_gap)
+        this->max_poll_gap = now - this->last_poll_at;
+      this->last_polls = polls;
+      this->last_poll_at = now;
+    }
+  }
+};
+
+uint32_t rng_state = 12345;
+uint32_t next_random() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++live_allocations;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void *ptr) noexcept {
+  if (ptr != nullptr)
+    --live_allocations;
+  std::free(ptr);
+}
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+
+TEST(weeks_of_operation_across_millis_wraparound) {
+  global_preferences->reset();
+  testing::set_millis(START_MILLIS);
+  // The noisy line logs a resync warning every few minutes of simulated time.
+  testing::set_log_level(ESPHOME_LOG_LEVEL_ERROR);
+
+  SoakUnit units[2] = {SoakUnit(7), SoakUnit(11)};
+  DaewooACBus bus;
+  for (SoakUnit &unit : units) {
+    unit.sim.attach(&unit.uart);
+    unit.ac.set_uart(&unit.uart);
+    bus.add_unit(&unit.ac);
+  }
+  for (SoakUnit &unit : units)
+    unit.ac.setup();
+  bus.setup();
+
+  testing::LinkFaults noisy;
+  noisy.response_jitter_ms = 30;
+  noisy.noise_percent = 2;
+  noisy.corrupt_byte_percent = 1;
+  noisy.drop_byte_percent = 1;
+  noisy.drop_reply_percent = 1;
+  for (SoakUnit &unit : units)
+    unit.sim.set_faults(noisy);
+
+  long baseline_allocations = 0;
+  long max_allocation_growth = 0;
+  size_t max_rx_backlog = 0;
+  size_t max_pending_replies = 0;
+  uint32_t bursts = 0;
+  uint32_t mismatches = 0;
+  bool wrapped = false;
+
+  const uint64_t total_steps = static_cast<uint64_t>(SOAK_DAYS) * DAY_MILLIS / STEP_MILLIS;
+  const uint64_t steps_per_hour = HOUR_MILLIS / STEP_MILLIS;
+  for (uint64_t step = 1; step <= total_steps; ++step) {
+    uint32_t before = millis();
+    testing::advance_millis(STEP_MILLIS);
+    uint32_t now = millis();
+    wrapped |= now < before;
+
+    for (SoakUnit &unit : units) {
+      unit.sim.tick(now);
+      if (unit.uart.rx_pending() > max_rx_backlog)
+        max_rx_backlog = unit.uart.rx_pending();
+      if (unit.sim.pending_replies() > max_pending_replies)
+        max_pending_replies = unit.sim.pending_replies();
+      unit.ac.loop();
+      unit.track_polls(now);
+    }
+    bus.loop();
+
+    uint64_t in_hour = step % steps_per_hour;
+    if (in_hour == 0) {
+      // Hourly control burst: several UI changes in quick succession on one unit.
+      SoakUnit &unit = units[bursts++ % 2];
+      unit.ac.make_call().set_mode(next_random() % 2 ? climate::CLIMATE_MODE_COOL : climate::CLIMATE_MODE_HEAT).perform();
+      unit.ac.make_call().set_target_temperature(18.0f + next_random() % 10).perform();
+      unit.ac.request_fan_mode(next_random() % 2 ? climate::CLIMATE_FAN_LOW : climate::CLIMATE_FAN_HIGH);
+      unit.ac.request_display(next_random() % 2 == 0);
+    } else if (in_hour == steps_per_hour / 3) {
+      // Someone uses the IR remote, and the room drifts.
+      SoakUnit &unit = units[next_random() % 2];
+      unit.sim.ir_remote().target_temperature = static_cast<uint8_t>(16 + next_random() % 17);
+      unit.sim.set_room_temperature(static_cast<uint8_t>(18 + next_random() % 12));
+    } else if (in_hour == steps_per_hour / 2) {
+      // Half past: everything should have settled and match the units.
+      for (SoakUnit &unit : units) {
+        if (unit.ac.target_temperature != unit.sim.state().target_temperature ||
+            unit.ac.current_temperature != unit.sim.state().current_temperature)
+          ++mismatches;
+      }
+      if (step / steps_per_hour == 24) {
+        baseline_allocations = live_allocations;
+      } else if (step / steps_per_hour > 24 && live_allocations - baseline_allocations > max_allocation_growth) {
+        max_allocation_growth = live_allocations - baseline_allocations;
+      }
+    }
+  }
+
+  std::printf("  %u days from millis()=%u (wrapped: %s), %u control bursts\n", SOAK_DAYS, START_MILLIS,
+              wrapped ? "yes" : "no", bursts);
+  for (SoakUnit &unit : units) {
+    const FrameParserStats &rx = unit.ac.get_rx_stats();
+    const testing::VirtualUnitStats &sim = unit.sim.get_stats();
+    std::printf("  unit: %u polls, %u writes, %u frames, %u resyncs, %u failed commits, max poll gap %u ms\n",
+                sim.polls, sim.writes, rx.frames, rx.resyncs, unit.ac.get_failed_commit_count(), unit.max_poll_gap);
+    EXPECT_LE(unit.max_poll_gap, MAX_POLL_GAP_MILLIS);
+    // At most one poll per regular interval, plus one confirmation poll per command.
+    EXPECT_LE(sim.polls, SOAK_DAYS * DAY_MILLIS / UPDATE_INTERVAL_DEFAULT_MILLIS + 2 * sim.writes + 20);
+    EXPECT_GE(sim.polls, SOAK_DAYS * (DAY_MILLIS / MAX_POLL_GAP_MILLIS));
+    EXPECT_EQ(unit.ac.get_failed_commit_count(), 0U);
+  }
+  std::printf("  heap: %ld live blocks growth after day 1; RX backlog <= %zu bytes; <= %zu pending replies\n",
+              max_allocation_growth, max_rx_backlog, max_pending_replies);
+  EXPECT_TRUE(wrapped);
+  EXPECT_EQ(mismatches, 0U);
+  EXPECT_LE(max_allocation_growth, 0);
+  EXPECT_LE(max_rx_backlog, MAX_RX_BACKLOG);
+  EXPECT_LE(max_pending_replies, 1U);
+}
@@ -0,0 +1,287 @@
+// Replay a UART trace captured with `dump_trace()` through the DaewooAC component itself.
+//
+// Built by the host target in tests/:
+//   cmake -S tests -B build && cmake --build build --target daewoo_ac_replay
+//
+// Usage:
+//   daewoo_ac_replay [--bench N] [--tx] [--step MS] [--log] [device.log]
+//
+// The input (stdin by default) is ESPHome log output containing the lines written
+// by dump_trace(), e.g. "[I][daewoo_ac.climate:287]:     123456 RX AA 14 01 ...".
+// Everything else is ignored. RX records hold the raw bytes of one UART read,
+// noise and broken frames included. They are fed to a DaewooAC through the host
+// UART at their recorded times, with loop() running every --step ms in between,
+// so framing, resyncs, timeouts, state sync, command confirmation and the
+// optimistic hold all run exactly as on the device. Recorded write commands are
+// re-issued through apply_state() at their timestamps. Every state the climate
+// publishes is printed. With --bench the capture is replayed N more times without
+// output to measure throughput.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "daewoo_ac/daewoo_ac.h"
+#include "esphome/core/log.h"
+
+using namespace esphome;
+using namespace esphome::daewoo_ac;
+
+namespace {
+
+struct CapturedFrame {
+  uint32_t timestamp;
+  TraceDirection direction;
+  std::vector<uint8_t> bytes;
+};
+
+struct ReplayResult {
+  FrameParserStats rx;
+  uint32_t commands{0};
+  uint32_t failed_commits{0};
+  uint32_t publishes{0};
+};
+
+int hex_value(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+// Parse "<timestamp> RX|TX <hex bytes>" anywhere in `line`.
+bool parse_trace_line(const std::string &line, CapturedFrame *frame) {
+  size_t pos = line.find(" RX ");
+  TraceDirection direction = TraceDirection::RX;
+  if (pos == std::string::npos) {
+    pos = line.find(" TX ");
+    direction = TraceDirection::TX;
+  }
+  if (pos == std::string::npos)
+    return false;
+
+  size_t start = pos;
+  while (start > 0 && line[start - 1] >= '0' && line[start - 1] <= '9')
+    --start;
+  if (start == pos)
+    return false;
+
+  frame->timestamp = static_cast<uint32_t>(std::strtoul(line.c_str() + start, nullptr, 10));
+  frame->direction = direction;
+  frame->bytes.clear();
+  for (size_t i = pos + 4; i + 1 < line.size(); i += 3) {
+    int high = hex_value(line[i]);
+    int low = hex_value(line[i + 1]);
+    if (high < 0 || low < 0)
+      break;
+    frame->bytes.push_back(static_cast<uint8_t>(high << 4 | low));
+  }
+  return !frame->bytes.empty();
+}
+
+// Turn a recorded write frame back into the request that produced it.
+bool decode_command(const std::vector<uint8_t> &bytes, StateChange *change) {
+  if (bytes.size() != MESSAGE_LENGTH || bytes[0] != FRAME_HEADER || bytes[2] != OPERATION_WRITE)
+    return false;
+  DaewooState state;
+  std::memcpy(&state, bytes.data() + 2, sizeof(DaewooState));
+
+  climate::ClimateMode mode = climate::CLIMATE_MODE_OFF;
+  if (state.power_state == 0x00 || MODE_MAP.decode(state.mode, &mode))
+    change->mode = mode;
+  change->target_temperature = state.target_temperature;
+  climate::ClimateFanMode fan_mode;
+  if (state.flags1 & QUIET_FLAG_MASK) {
+    change->fan_mode = climate::CLIMATE_FAN_QUIET;
+  } else if (FAN_MODE_MAP.decode(state.fan_mode, &fan_mode)) {
+    change->fan_mode = fan_mode;
+  }
+  VerticalVanePosition position;
+  if (VERTICAL_VANE_MAP.decode(state.vertical_vane, &position))
+    change->vertical_vane = position;
+  change->horizontal_swing = (state.flags0 & HORIZONTAL_SWING_FLAG_MASK) != 0;
+  change->display = (state.flags1 & DISPLAY_FLAG_MASK) != 0;
+  change->uv_light = (state.flags1 & UV_LIGHT_FLAG_MASK) != 0;
+  return true;
+}
+
+const char *mode_name(climate::ClimateMode mode) {
+  switch (mode) {
+    case climate::CLIMATE_MODE_OFF:
+      return "OFF";
+    case climate::CLIMATE_MODE_AUTO:
+      return "AUTO";
+    case climate::CLIMATE_MODE_COOL:
+      return "COOL";
+    case climate::CLIMATE_MODE_DRY:
+      return "DRY";
+    case climate::CLIMATE_MODE_HEAT:
+      return "HEAT";
+    case climate::CLIMATE_MODE_FAN_ONLY:
+      return "FAN_ONLY";
+    default:
+      return "?";
+  }
+}
+
+const char *fan_mode_name(const optional<climate::ClimateFanMode> &fan_mode) {
+  if (!fan_mode.has_value())
+    return "-";
+  switch (*fan_mode) {
+    case climate::CLIMATE_FAN_AUTO:
+      return "AUTO";
+    case climate::CLIMATE_FAN_LOW:
+      return "LOW";
+    case climate::CLIMATE_FAN_MEDIUM:
+      return "MEDIUM";
+    case climate::CLIMATE_FAN_HIGH:
+      return "HIGH";
+    case climate::CLIMATE_FAN_QUIET:
+      return "QUIET";
+    default:
+      return "?";
+  }
+}
+
+void print_state(DaewooAC &ac) {
+  std::printf("%10u mode=%s target=%.0f current=%.0f fan=%s vane=%s hswing=%s display=%s uv=%s\n", millis(),
+              mode_name(ac.mode), ac.target_temperature, ac.current_temperature, fan_mode_name(ac.fan_mode),
+              ac.get_vertical_vane_label(), ac.is_horizontal_swing_on() ? "on" : "off",
+              ac.is_display_on() ? "on" : "off", ac.is_uv_light_on() ? "on" : "off");
+}
+
+// Run the whole capture through a fresh DaewooAC.
+ReplayResult replay(const std::vector<CapturedFrame> &capture, uint32_t step, bool verbose) {
+  ReplayResult result;
+  global_preferences->reset();
+  testing::set_millis(capture.front().timestamp);
+
+  uart::UARTComponent uart;
+  // The replayed component's own polls and commands go nowhere; the capture already holds the AC's answers.
+  uart.set_write_handler([](const uint8_t *, size_t) {});
+  DaewooAC ac;
+  ac.set_uart(&uart);
+  ac.setup();
+  ac.add_on_state_callback([&](climate::Climate &) {
+    ++result.publishes;
+    if (verbose)
+      print_state(ac);
+  });
+
+  for (const CapturedFrame &entry : capture) {
+    while (static_cast<int32_t>(entry.timestamp - millis()) > static_cast<int32_t>(step)) {
+      testing::advance_millis(step);
+      ac.loop();
+    }
+    testing::set_millis(entry.timestamp);
+
+    if (entry.direction == TraceDirection::RX) {
+      uart.inject_rx(entry.bytes);
+      ac.loop();
+      continue;
+    }
+    StateChange change;
+    if (decode_command(entry.bytes, &change)) {
+      ++result.commands;
+      ac.apply_state(change);
+    }
+  }
+
+  // Let a trailing command time out or be confirmed.
+  for (uint32_t t = 0; t < 20000; t += step) {
+    testing::advance_millis(step);
+    ac.loop();
+  }
+
+  result.rx = ac.get_rx_stats();
+  result.failed_commits = ac.get_failed_commit_count();
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  long bench = 0;
+  bool show_tx = false;
+  uint32_t step = 5;
+  const char *path = nullptr;
+  testing::set_log_level(ESPHOME_LOG_LEVEL_ERROR);
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+      bench = std::strtol(argv[++i], nullptr, 10);
+    } else if (std::strcmp(argv[i], "--step") == 0 && i + 1 < argc) {
+      step = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (std::strcmp(argv[i], "--tx") == 0) {
+      show_tx = true;
+    } else if (std::strcmp(argv[i], "--log") == 0) {
+      testing::set_log_level(ESPHOME_LOG_LEVEL_DEBUG);
+    } else if (argv[i][0] != '-' && path == nullptr) {
+      path = argv[i];
+    } else {
+      std::fprintf(stderr, "usage: %s [--bench N] [--tx] [--step MS] [--log] [device.log]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (step == 0)
+    step = 1;
+
+  std::ifstream file;
+  if (path != nullptr) {
+    file.open(path);
+    if (!file) {
+      std::fprintf(stderr, "Cannot open %s\n", path);
+      return 1;
+    }
+  }
+  std::istream &input = path != nullptr ? file : std::cin;
+
+  std::vector<CapturedFrame> capture;
+  std::string line;
+  CapturedFrame frame;
+  while (std::getline(input, line)) {
+    if (parse_trace_line(line, &frame))
+      capture.push_back(frame);
+  }
+  if (capture.empty()) {
+    std::fprintf(stderr, "No trace lines found in input\n");
+    return 1;
+  }
+
+  if (show_tx) {
+    for (const CapturedFrame &entry : capture) {
+      if (entry.direction != TraceDirection::TX)
+        continue;
+      char hex[MESSAGE_LENGTH * 3 + 1];
+      format_frame_hex(entry.bytes, 0, std::min(entry.bytes.size(), MESSAGE_LENGTH), hex);
+      std::printf("%10u TX %s\n", entry.timestamp, hex);
+    }
+  }
+
+  ReplayResult result = replay(capture, step, true);
+  const FrameParserStats &stats = result.rx;
+  std::printf("%zu trace records, %u frames accepted, %u length errors, %u checksum errors, %u resyncs "
+              "(%u bytes discarded), %u timeouts\n",
+              capture.size(), stats.frames, stats.length_errors, stats.checksum_errors, stats.resyncs,
+              stats.bytes_discarded, stats.timeouts);
+  std::printf("%u commands replayed, %u not confirmed, %u states published\n", result.commands,
+              result.failed_commits, result.publishes);
+
+  if (bench > 0) {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t frames = 0;
+    for (long i = 0; i < bench; ++i)
+      frames += replay(capture, step, false).rx.frames;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("Replayed %ld times: %llu frames in %.3f s (%.0f frames/s)\n", bench,
+                static_cast<unsigned long long>(frames), seconds, seconds > 0 ? frames / seconds : 0.0);
+  }
+  return 0;
+}